@@ -0,0 +1,141 @@
+#include "CartridgeBackup.h"
+
+void Eeprom::reset(SaveFile* save, SaveType type)
+{
+	this->save = save;
+	addressBits = (saveTypeSize(type) > 0x200) ? EEPROM_ADDRESS_BITS_8KB : EEPROM_ADDRESS_BITS_512B;
+
+	state = EepromState::Command;
+	reading = false;
+	bitsLeft = 2;
+	address = 0;
+	buffer = 0;
+	readData = 0;
+	readRemaining = 0;
+}
+
+u16 Eeprom::read()
+{
+	//1 = ready, writes finish instantly
+	if (readRemaining == 0)
+		return 1;
+
+	u32 bit = EEPROM_READ_BITS - readRemaining;
+	readRemaining--;
+	if (bit < 4)
+		return 0;
+	return (readData >> (63 - (bit - 4))) & 0x1;
+}
+
+void Eeprom::write(u16 value)
+{
+	u8 bit = value & 0x1;
+	buffer = (buffer << 1) | bit;
+	if (--bitsLeft != 0)
+		return;
+
+	switch (state) {
+		case EepromState::Command:
+			//Anything but a read or write request starts over
+			if ((buffer & 0x2) == 0) {
+				bitsLeft = 2;
+			}
+			else {
+				reading = (buffer & 0x1) != 0;
+				state = EepromState::Address;
+				bitsLeft = addressBits;
+			}
+			break;
+		case EepromState::Address:
+			address = buffer;
+			state = reading ? EepromState::Stop : EepromState::Data;
+			bitsLeft = reading ? 1 : 64;
+			break;
+		case EepromState::Data:
+			readData = buffer; //kept for the stop bit
+			state = EepromState::Stop;
+			bitsLeft = 1;
+			break;
+		case EepromState::Stop:
+			if (reading)
+				beginRead();
+			else
+				commitWrite();
+			state = EepromState::Command;
+			bitsLeft = 2;
+			break;
+	}
+	buffer = 0;
+}
+
+void Eeprom::commitWrite()
+{
+	u32 offset = (address * EEPROM_BLOCK_SIZE) & (save->size - 1);
+	//Bits come msb first, the first bit is bit 7 of byte 0
+	for (s32 i = 0; i < EEPROM_BLOCK_SIZE; i++)
+		save->data[offset + i] = readData >> (56 - i * 8);
+	save->markDirty(offset, EEPROM_BLOCK_SIZE);
+	readData = 0;
+}
+
+void Eeprom::beginRead()
+{
+	u32 offset = (address * EEPROM_BLOCK_SIZE) & (save->size - 1);
+	readData = 0;
+	for (s32 i = 0; i < EEPROM_BLOCK_SIZE; i++)
+		readData = (readData << 8) | save->data[offset + i];
+	readRemaining = EEPROM_READ_BITS;
+}
+
+void Eeprom::writeStream(const u16* stream, u32 length)
+{
+	//The request length tells the bus width, games only ever send one of these
+	u8 bits = addressBits;
+	if (length == 2 + EEPROM_ADDRESS_BITS_512B + 1 || length == 2 + EEPROM_ADDRESS_BITS_512B + 64 + 1)
+		bits = EEPROM_ADDRESS_BITS_512B;
+	else if (length == 2 + EEPROM_ADDRESS_BITS_8KB + 1 || length == 2 + EEPROM_ADDRESS_BITS_8KB + 64 + 1)
+		bits = EEPROM_ADDRESS_BITS_8KB;
+
+	bool command = (stream[0] & 0x1) != 0;
+	bool isRead = (stream[1] & 0x1) != 0;
+	bool whole = state == EepromState::Command && bitsLeft == 2 && command &&
+		length == 2 + bits + (isRead ? 0u : 64u) + 1;
+
+	if (!whole) {
+		for (u32 i = 0; i < length; i++)
+			write(stream[i]);
+		return;
+	}
+
+	addressBits = bits;
+	u32 pos = 2;
+	address = 0;
+	for (u32 i = 0; i < bits; i++)
+		address = (address << 1) | (stream[pos++] & 0x1);
+
+	if (isRead) {
+		beginRead();
+		return;
+	}
+
+	u64 data = 0;
+	for (u32 i = 0; i < 64; i++)
+		data = (data << 1) | (stream[pos++] & 0x1);
+	readData = data;
+	commitWrite();
+}
+
+void Eeprom::readStream(u16* stream, u32 length)
+{
+	if (length != EEPROM_READ_BITS || readRemaining != EEPROM_READ_BITS) {
+		for (u32 i = 0; i < length; i++)
+			stream[i] = read();
+		return;
+	}
+
+	for (u32 i = 0; i < 4; i++)
+		stream[i] = 0;
+	for (u32 i = 0; i < 64; i++)
+		stream[4 + i] = (readData >> (63 - i)) & 0x1;
+	readRemaining = 0;
+}
@@ -1,10 +1,54 @@
 #pragma once
-#include "../../Utils/Utils.h"
+#include "SaveFile.h"
+#include "SaveDetector.h"
 
 //eeprom accessed on cartridge wait state 2
-//D000000 - 0DFFFFFF according to eeprom article
+//D000000 - 0DFFFFFF according to eeprom article,
+//only DFFFF00 - DFFFFFF on roms larger than 16MB
+#define EEPROM_START_ADDR 0xD000000
+#define EEPROM_LARGE_ROM_START_ADDR 0xDFFFF00
+#define EEPROM_END_ADDR 0xDFFFFFF
+
+#define EEPROM_BLOCK_SIZE 8 //bytes per read/write
+#define EEPROM_ADDRESS_BITS_512B 6
+#define EEPROM_ADDRESS_BITS_8KB 14
+#define EEPROM_READ_BITS 68 //4 junk bits then 64 data bits
+#define EEPROM_MAX_REQUEST_BITS (2 + EEPROM_ADDRESS_BITS_8KB + 64 + 1)
+
+enum class EepromState : u8 {
+	Command, //2 bits, 10 = write, 11 = read
+	Address,
+	Data,
+	Stop
+};
+
+/*
+	Serial eeprom, every 16 bit access moves one bit (bit 0) in or out, msb first.
+	Write request: 10, address, 64 data bits, 0
+	Read request: 11, address, 0, then 68 bits are read back
+	Games move a whole request with one dma 3 transfer, those are handled
+	as a whole by writeStream/readStream
+*/
 struct Eeprom {
-	u8 size : 1; //1 = 512 byte , 0 = 8kb
-	bool begin_read;
-	bool begin_write;
+	void reset(SaveFile* save, SaveType type);
+	u16 read();
+	void write(u16 value);
+
+	void writeStream(const u16* stream, u32 length);
+	void readStream(u16* stream, u32 length);
+
+	void commitWrite();
+	void beginRead();
+
+	SaveFile* save = nullptr;
+	u8 addressBits = EEPROM_ADDRESS_BITS_8KB;
+
+	EepromState state = EepromState::Command;
+	bool reading = false; //the request is a read
+	u32 bitsLeft = 0; //in the current field
+	u32 address = 0; //block
+	u64 buffer = 0;
+
+	u64 readData = 0;
+	u32 readRemaining = 0;
 };
@@ -0,0 +1,118 @@
+#include "Flash.h"
+
+void Flash::reset(SaveFile* save, SaveType type)
+{
+	this->save = save;
+	atmel = false;
+	switch (type) {
+		case SaveType::Flash_512k_Atmel:
+		case SaveType::Flash_512k_Atmel_RTC:
+			manufacturer = 0x1F; device = 0x3D; atmel = true; break;
+		case SaveType::Flash_512k_SST:
+		case SaveType::Flash_512k_SST_RTC:
+			manufacturer = 0xBF; device = 0xD4; break;
+		case SaveType::Flash_512k_Panasonic:
+		case SaveType::Flash_512k_Panasonic_RTC:
+			manufacturer = 0x32; device = 0x1B; break;
+		case SaveType::Flash_1M_Macronix:
+		case SaveType::Flash_1M_Macronix_RTC:
+			manufacturer = 0xC2; device = 0x09; break;
+		case SaveType::Flash_1M_Sanyo:
+		case SaveType::Flash_1M_Sanyo_RTC:
+		default:
+			manufacturer = 0x62; device = 0x13; break;
+	}
+
+	step = 0;
+	idMode = false;
+	eraseArmed = false;
+	bankArmed = false;
+	programRemaining = 0;
+	bank = 0;
+}
+
+u8 Flash::read(u32 address)
+{
+	u32 offset = address & (FLASH_BANK_SIZE - 1);
+	if (idMode && offset < 2)
+		return (offset == 0) ? manufacturer : device;
+
+	return save->data[bank * FLASH_BANK_SIZE + offset];
+}
+
+void Flash::write(u32 address, u8 value)
+{
+	u32 offset = address & (FLASH_BANK_SIZE - 1);
+	if (programRemaining != 0) {
+		program(offset, value);
+		return;
+	}
+
+	if (bankArmed) {
+		bankArmed = false;
+		if (offset == 0 && save->size > FLASH_BANK_SIZE)
+			bank = value & 0x1;
+		return;
+	}
+
+	switch (step) {
+		case 0:
+			if (offset == FLASH_COMMAND_ADDR1 && value == 0xAA)
+				step = 1;
+			else if (value == 0xF0) //exit id mode/abort, some chips take it without the prefix
+				idMode = false;
+			break;
+		case 1:
+			step = (offset == FLASH_COMMAND_ADDR2 && value == 0x55) ? 2 : 0;
+			break;
+		case 2:
+			step = 0;
+			command(offset, value);
+			break;
+	}
+}
+
+void Flash::command(u32 offset, u8 value)
+{
+	//Second half of an erase, sector erase is sent to the sector itself
+	if (eraseArmed) {
+		eraseArmed = false;
+		if (offset == FLASH_COMMAND_ADDR1 && value == 0x10)
+			eraseChip();
+		else if (value == 0x30)
+			eraseSector(offset);
+		return;
+	}
+
+	if (offset != FLASH_COMMAND_ADDR1)
+		return;
+
+	switch (value) {
+		case 0x90: idMode = true; break;
+		case 0xF0: idMode = false; break;
+		case 0x80: eraseArmed = true; break;
+		case 0xA0: programRemaining = atmel ? FLASH_ATMEL_PAGE_SIZE : 1; break;
+		case 0xB0: bankArmed = true; break;
+	}
+}
+
+void Flash::program(u32 offset, u8 value)
+{
+	u32 index = bank * FLASH_BANK_SIZE + offset;
+	save->data[index] = value;
+	save->markDirty(index);
+	programRemaining--;
+}
+
+void Flash::eraseChip()
+{
+	std::fill(save->data, save->data + save->size, 0xFF);
+	save->markDirty(0, save->size);
+}
+
+void Flash::eraseSector(u32 offset)
+{
+	u32 start = bank * FLASH_BANK_SIZE + (offset & ~(FLASH_SECTOR_SIZE - 1));
+	std::fill(save->data + start, save->data + start + FLASH_SECTOR_SIZE, 0xFF);
+	save->markDirty(start, FLASH_SECTOR_SIZE);
+}
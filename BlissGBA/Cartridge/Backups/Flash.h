@@ -0,0 +1,37 @@
+#pragma once
+#include "SaveFile.h"
+#include "SaveDetector.h"
+
+#define FLASH_BANK_SIZE 0x10000
+#define FLASH_SECTOR_SIZE 0x1000
+#define FLASH_ATMEL_PAGE_SIZE 0x80
+#define FLASH_COMMAND_ADDR1 0x5555
+#define FLASH_COMMAND_ADDR2 0x2AAA
+
+/*
+	64KB or 128KB flash chip. Commands are written as AA to 5555, 55 to 2AAA
+	and then the command byte. The 128KB chips have two 64KB banks, only one
+	of them is mapped at a time
+*/
+struct Flash {
+	void reset(SaveFile* save, SaveType type);
+	u8 read(u32 address);
+	void write(u32 address, u8 value);
+
+	void command(u32 offset, u8 value);
+	void program(u32 offset, u8 value);
+	void eraseChip();
+	void eraseSector(u32 offset);
+
+	SaveFile* save = nullptr;
+	u8 manufacturer = 0;
+	u8 device = 0;
+	bool atmel = false; //atmel chips program 128 byte pages and have no erase
+
+	u8 step = 0; //bytes of the AA 55 command prefix seen
+	bool idMode = false;
+	bool eraseArmed = false;
+	bool bankArmed = false;
+	u32 programRemaining = 0; //bytes left to program
+	u32 bank = 0;
+};
@@ -1,6 +1,5 @@
 #pragma once
 #include "../../Utils/Utils.h"
-#include <unordered_map>
 
 enum class SaveType : u8{
     EEPROM_4k,
@@ -24,6 +23,14 @@ enum class SaveType : u8{
 
 class GamePak;
 
+bool isFlash(SaveType type);
+bool isEeprom(SaveType type);
+//Bytes of backup memory, 0 for none
+u32 saveTypeSize(SaveType type);
+
 SaveType detectSavetype(GamePak& pak);
 SaveType lookupSavetype(GamePak& pak);
-void setupSaveDatabase();
\ No newline at end of file
+//Searches the rom for the save library id strings
+SaveType scanSavetype(const u8* data, u32 size);
+//Searches the rom for the sdk rtc library id
+bool scanRtc(const u8* data, u32 size);
\ No newline at end of file
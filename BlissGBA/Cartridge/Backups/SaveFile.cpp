@@ -0,0 +1,217 @@
+#include "SaveFile.h"
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+SaveFile::SaveFile()
+	:data(nullptr),
+	size(0),
+	mapped(false),
+	dirty(0),
+	running(false)
+#ifdef _WIN32
+	,file(INVALID_HANDLE_VALUE),
+	mapping(nullptr)
+#endif
+{
+}
+
+SaveFile::~SaveFile()
+{
+	close();
+}
+
+#ifdef _WIN32
+static u8* mapSaveFile(SaveFile& save, const std::string& fileName, u32 size)
+{
+	save.file = CreateFileA(fileName.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+		nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (save.file == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(save.file, &fileSize))
+		return nullptr;
+
+	//Mapping more than the file holds grows it with zeroes
+	save.mapping = CreateFileMappingA(save.file, nullptr, PAGE_READWRITE, 0, size, nullptr);
+	if (save.mapping == nullptr)
+		return nullptr;
+
+	u8* view = (u8*)MapViewOfFile(save.mapping, FILE_MAP_WRITE, 0, 0, size);
+	if (view == nullptr)
+		return nullptr;
+
+	//Erased backup memory reads as 0xFF
+	if (fileSize.QuadPart < size)
+		std::fill(view + fileSize.QuadPart, view + size, 0xFF);
+	return view;
+}
+
+static void unmapSaveFile(SaveFile& save)
+{
+	if (save.data) UnmapViewOfFile(save.data);
+	if (save.mapping) CloseHandle(save.mapping);
+	if (save.file != INVALID_HANDLE_VALUE) CloseHandle(save.file);
+
+	save.mapping = nullptr;
+	save.file = INVALID_HANDLE_VALUE;
+}
+
+static void syncSaveFile(SaveFile& save, u32 offset, u32 length)
+{
+	FlushViewOfFile(save.data + offset, length);
+}
+
+static void syncSaveFileDone(SaveFile& save)
+{
+	FlushFileBuffers(save.file);
+}
+#else
+static u8* mapSaveFile(SaveFile& /*save*/, const std::string& fileName, u32 size)
+{
+	int fd = ::open(fileName.c_str(), O_RDWR | O_CREAT, 0644);
+	if (fd < 0)
+		return nullptr;
+
+	struct stat info;
+	if (fstat(fd, &info) != 0 || ((u64)info.st_size < size && ftruncate(fd, size) != 0)) {
+		::close(fd);
+		return nullptr;
+	}
+
+	void* view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (view == MAP_FAILED)
+		return nullptr;
+
+	//Erased backup memory reads as 0xFF
+	if ((u64)info.st_size < size)
+		std::fill((u8*)view + info.st_size, (u8*)view + size, 0xFF);
+	return (u8*)view;
+}
+
+static void unmapSaveFile(SaveFile& save)
+{
+	if (save.data) munmap(save.data, save.size);
+}
+
+static void syncSaveFile(SaveFile& save, u32 offset, u32 length)
+{
+	msync(save.data + offset, length, MS_SYNC);
+}
+
+static void syncSaveFileDone(SaveFile& /*save*/)
+{
+}
+#endif
+
+bool SaveFile::open(const std::string& fileName, u32 size)
+{
+	close();
+	if (size == 0 || size > SAVE_MAX_SIZE)
+		return false;
+
+	this->size = size;
+	if (!fileName.empty())
+		data = mapSaveFile(*this, fileName, size);
+
+	mapped = (data != nullptr);
+	if (!mapped) {
+		if (!fileName.empty()) {
+			std::cerr << "Save file <" << fileName << "> could not be opened, saves won't be kept\n";
+			unmapSaveFile(*this);
+		}
+		data = new u8[size];
+		std::fill(data, data + size, 0xFF);
+		return fileName.empty();
+	}
+
+	running = true;
+	flusher = std::thread(&SaveFile::flushLoop, this);
+	return true;
+}
+
+void SaveFile::close()
+{
+	if (flusher.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(flushLock);
+			running = false;
+		}
+		flushWake.notify_one();
+		flusher.join();
+	}
+
+	if (mapped) {
+		flush();
+		unmapSaveFile(*this);
+	}
+	else if (data) {
+		delete[] data;
+	}
+
+	data = nullptr;
+	size = 0;
+	mapped = false;
+	dirty = 0;
+}
+
+void SaveFile::markDirty(u32 offset, u32 length)
+{
+	if (length == 0)
+		return;
+
+	u32 first = offset / SAVE_PAGE_SIZE;
+	u32 last = (offset + length - 1) / SAVE_PAGE_SIZE;
+	u64 pages = 0;
+	for (u32 page = first; page <= last; page++)
+		pages |= 1ull << page;
+	dirty.fetch_or(pages, std::memory_order_relaxed);
+}
+
+void SaveFile::flush()
+{
+	if (!mapped)
+		return;
+
+	u64 pages = dirty.exchange(0, std::memory_order_acquire);
+	if (pages == 0)
+		return;
+
+	//One sync per run of neighbouring dirty pages
+	u32 page = 0;
+	while (pages != 0) {
+		if ((pages & 0x1) == 0) {
+			pages >>= 1;
+			page++;
+			continue;
+		}
+
+		u32 first = page;
+		while (pages & 0x1) {
+			pages >>= 1;
+			page++;
+		}
+		u32 offset = first * SAVE_PAGE_SIZE;
+		u32 end = std::min(page * SAVE_PAGE_SIZE, size);
+		syncSaveFile(*this, offset, end - offset);
+	}
+	syncSaveFileDone(*this);
+}
+
+void SaveFile::flushLoop()
+{
+	std::unique_lock<std::mutex> lock(flushLock);
+	while (running) {
+		flushWake.wait_for(lock, std::chrono::milliseconds(SAVE_FLUSH_INTERVAL), [this] { return !running; });
+		flush();
+	}
+}
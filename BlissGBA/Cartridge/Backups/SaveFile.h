@@ -0,0 +1,48 @@
+#pragma once
+#include "../../Utils/Utils.h"
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#define SAVE_PAGE_SIZE 0x1000 //dirty tracking granularity, one bit per page
+#define SAVE_MAX_SIZE (SAVE_PAGE_SIZE * 64)
+#define SAVE_FLUSH_INTERVAL 1000 //ms, the most save data a crash can lose
+
+/*
+	Cartridge backup memory mapped onto the .sav file. The emulation thread
+	only writes memory and marks pages dirty, a background thread writes the
+	dirty pages out to disk in batches.
+	Without a file name the backup only lives in memory
+*/
+struct SaveFile {
+	SaveFile();
+	~SaveFile();
+	bool open(const std::string& fileName, u32 size);
+	void close();
+
+	inline void markDirty(u32 offset)
+	{
+		u64 page = 1ull << (offset / SAVE_PAGE_SIZE);
+		if ((dirty.load(std::memory_order_relaxed) & page) == 0)
+			dirty.fetch_or(page, std::memory_order_relaxed);
+	}
+	void markDirty(u32 offset, u32 length);
+	void flush();
+	void flushLoop();
+
+	u8* data;
+	u32 size;
+	bool mapped;
+	std::atomic<u64> dirty;
+
+	std::atomic<bool> running;
+	std::mutex flushLock;
+	std::condition_variable flushWake;
+	std::thread flusher;
+
+#ifdef _WIN32
+	void* file;
+	void* mapping;
+#endif
+};
@@ -0,0 +1,1764 @@
+#include "GameDatabase.h"
+
+/*
+	Sorted by code then crc at compile time, looked up with a binary search.
+	Save types are from https://github.com/profi200/open_agb_firm/issues/9
+*/
+static constexpr GameEntry games[] = {
+	{"A22", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       EZ-Talk - Shokyuu Hen 1
+	{"A23", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       EZ-Talk - Shokyuu Hen 2
+	{"A24", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       EZ-Talk - Shokyuu Hen 3
+	{"A25", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       EZ-Talk - Shokyuu Hen 4
+	{"A26", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       EZ-Talk - Shokyuu Hen 5
+	{"A27", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       EZ-Talk - Shokyuu Hen 6
+	{"A29", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Mickey to Minnie no Magical Quest 2
+	{"A2A", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Disney Sports - Basketball
+	{"A2B", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Bubble Bobble - Old & New
+	{"A2C", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Castlevania - Aria of Sorrow
+	{"A2D", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Darius R
+	{"A2F", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Defender
+	{"A2G", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     GT Advance 3 - Pro Concept Racing
+	{"A2H", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Hajime no Ippo - The Fighting!
+	{"A2I", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V120     Magi Nation
+	{"A2J", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V121     J.League - Winning Eleven Advance 2002
+	{"A2K", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Spy Kids Challenger
+	{"A2L", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Legends of Wrestling II
+	{"A2M", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Madden NFL 2002
+	{"A2N", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V130      Sonic Advance 2
+	{"A2O", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     K-1 Pocket Grand Prix 2
+	{"A2P", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Bouken Yuuki Pluster World - Pluston GP
+	{"A2Q", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Monster Rancher Advance 2
+	{"A2R", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Bratz
+	{"A2S", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Spyro 2 - Season of Flame
+	{"A2T", 0, SaveType::NONE, 0, 0}, // NONE}            Pinball Tycoon
+	{"A2U", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Mother 1+2
+	{"A2V", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Kisekko Gurumi - Chesty to Nuigurumi-tachi no Mahou no Bouken
+	{"A2W", 0, SaveType::NONE, 0, 0}, // NONE}            Star Wars - The New Droid Army
+	{"A2X", 0, SaveType::NONE, 0, 0}, // NONE}            MX 2002 - Featuring Ricky Carmichael
+	{"A2Y", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Top Gun - Combat Zones
+	{"A2Z", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Zen-Nippon Shounen Soccer Taikai 2 - Mezase Nippon-ichi!
+	{"A39", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Lode Runner
+	{"A3A", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Yoshi's Island - Super Mario Advance 3
+	{"A3B", 0, SaveType::NONE, 0, 0}, // NONE}            Sabrina - The Teenage Witch - Potion Commotion
+	{"A3C", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Crazy Taxi - Catch a Ride
+	{"A3D", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Disney Sports - Football
+	{"A3E", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Bakuten Shoot Beyblade 2002 - Team Battle!! Daichi Hen
+	{"A3G", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Gyakuten Saiban 2
+	{"A3H", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Hime Kishi Monogatari - Princess Blue
+	{"A3J", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Gyakuten Saiban 3
+	{"A3K", 0, SaveType::NONE, 0, 0}, // NONE}            International Karate Plus
+	{"A3M", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Magical Quest Starring Mickey & Minnie
+	{"A3N", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Monster Summoner
+	{"A3O", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Di Gi Charat - DigiCommunication
+	{"A3P", 0, SaveType::NONE, 0, 0}, // NONE}            Sega Smash Pack
+	{"A3Q", 0, SaveType::NONE, 0, 0}, // NONE}            A Sound of Thunder
+	{"A3R", 0, SaveType::NONE, 0, 0}, // NONE}            The Revenge of Shinobi
+	{"A3T", 0, SaveType::NONE, 0, 0}, // NONE}            The Three Stooges
+	{"A3U", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Mother 3
+	{"A3V", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Sonic Pinball Party
+	{"A3W", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Bakuten Shoot Beyblade 2002 - Team Battle!! Takao Hen
+	{"A3X", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       MegaMan Battle Network 3 Blue
+	{"A3Z", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Street Jam Basketball
+	{"A4A", 0, SaveType::NONE, 0, 0}, // NONE}            The Simpsons - Road Rage
+	{"A4B", 0, SaveType::NONE, 0, 0}, // NONE}            Monster! Bass Fishing
+	{"A4C", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     I Spy Challenger!
+	{"A4D", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Disney Sports - Skateboarding
+	{"A4G", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     ZatchBell! - Electric Arena
+	{"A4K", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Hamster Club 4
+	{"A4L", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Sylvania Family 4 - Meguru Kisetsu no Tapestry
+	{"A4M", 0, SaveType::NONE, 0, 0}, // NONE}            Manic Miner
+	{"A4N", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Harvest Moon - Friends of Mineral Town
+	{"A4P", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Sister Princess - RePure
+	{"A4R", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Rock N' Roll Racing
+	{"A4S", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Spyro Advance
+	{"A4V", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Yuujou no Victory Goal 4v4 Arashi - Get the Goal!!
+	{"A4W", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Gachaste! Dino Device 2 Phoenix
+	{"A4X", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Gachaste! Dino Device 2 Dragon
+	{"A52", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Koukou Juken Advance Series Eitango Hen - 2000 Words Shuuroku
+	{"A53", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Koukou Juken Advance Series Eijukugo Hen - 650 Phrases Shuuroku
+	{"A54", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Koukou Juken Advance Series Eigo Koubun Hen - 26 Units Shuuroku
+	{"A55", 0, SaveType::NONE, 0, 0}, // NONE}            Who Wants to Be a Millionaire
+	{"A56", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     DokiDoki Cooking Series 1 - Komugi-chan no Happy Cake
+	{"A57", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Scan Hunter - Sennen Kaigyo wo Oe!
+	{"A59", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Toukon Heat
+	{"A5A", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Bionicle - Matoran Adventures
+	{"A5B", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Chocobo Land - A Game of Dice
+	{"A5C", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Sim City 2000
+	{"A5D", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Disney Sports - Snowboarding
+	{"A5G", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Dragon Drive - World D Break
+	{"A5K", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Medarot 2 Core - Kabuto Version
+	{"A5M", 0, SaveType::NONE, 0, 0}, // NONE}            MLB SlugFest 20-04
+	{"A5N", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Donkey Kong Country
+	{"A5P", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Power Pro Kun Pocket 5
+	{"A5Q", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Medarot 2 Core - Kuwagata Version
+	{"A5S", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Oshare Wanko
+	{"A5T", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Shin Megami Tensei 2
+	{"A5U", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Space Channel 5 - Ulala's Cosmic Attack
+	{"A5W", 0, SaveType::NONE, 0, 0}, // NONE}            Rugrats - Go Wild
+	{"A62", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       MegaMan Zero 2
+	{"A63", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Kawaii Pet Shop Monogatari 3
+	{"A64", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Shimura Ken no Baka Tonosama
+	{"A6B", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       MegaMan Battle Network 3 White
+	{"A6C", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Croket! - Yume no Banker Survival!
+	{"A6D", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Disney Sports - Soccer
+	{"A6G", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Monster Gate - Ooinaru Dungeon - Fuuin no Orb
+	{"A6M", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     MegaMan & Bass
+	{"A6O", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Onimusha Tactics
+	{"A6R", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Shifting Gears - Road Trip
+	{"A6S", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Super Robot Taisen D
+	{"A6T", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Dr. Muto
+	{"A73", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Whistle! - Dai 37 Kai Tokyo-to Chuugakkou Sougou Taiiku Soccer Taikai
+	{"A7A", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Naruto - Ninja Council
+	{"A7G", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Sengoku Kakumei Gaiden
+	{"A7H", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Harry Potter and the Chamber of Secrets
+	{"A7I", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Silk to Cotton
+	{"A7K", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Kirby - Nightmare in Dream Land
+	{"A7M", 0, SaveType::NONE, 0, 0}, // NONE}            The Amazing Virtual Sea Monkeys
+	{"A7O", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     James Bond 007 - NightFire
+	{"A7S", 0, SaveType::NONE, 0, 0}, // NONE}            The Smurfs - The Revenge of the Smurfs
+	{"A82", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Hamster Paradise - Pure Heart
+	{"A83", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Hamster Monogatari 3 GBA
+	{"A84", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Hamtaro - Rainbow Rescue
+	{"A85", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Sanrio Puroland All Characters
+	{"A86", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Sonic Pinball Party
+	{"A87", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Ohanaya-San Monogatari GBA
+	{"A88", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Mario & Luigi - Superstar Saga
+	{"A89", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       MegaMan - Battle Chip Challenge
+	{"A8B", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Medabots - Metabee Version
+	{"A8C", 0, SaveType::NONE, 0, 0}, // NONE}            Card Party
+	{"A8D", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Doubutsu Shima no Chobi Gurumi
+	{"A8E", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Hachiemon
+	{"A8G", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      GetBackers Dakkanya - Metropolis Dakkan Sakusen!
+	{"A8H", 0, SaveType::NONE, 0, 0}, // NONE}            Cabela's Big Game Hunter
+	{"A8L", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       BB Ball
+	{"A8M", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Kotoba no Puzzle - Mojipittan Advance
+	{"A8N", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Hunter X Hunter - Minna Tomodachi Daisakusen!!
+	{"A8O", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     DokiDoki Cooking Series 2 - Gourmet Kitchen - Suteki na Obentou
+	{"A8P", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Derby Stallion Advance
+	{"A8Q", 0, SaveType::NONE, 0, 0}, // NONE}            Pirates of the Caribbean - The Curse of the Black Pearl
+	{"A8R", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Tennis no Ouji-sama 2003 - Passion Red
+	{"A8S", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Digimon - Battle Spirit
+	{"A8T", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V130      RPG Tsukuru Advance
+	{"A8V", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Boboboubo Boubobo - Ougi 87.5 Bakuretsu Hanage Shinken
+	{"A8Y", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Best Play Pro Yakyuu
+	{"A8Z", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Shin Megami Tensei Devil Children - Puzzle de Call!
+	{"A9A", 0, SaveType::NONE, 0, 0}, // NONE}            Demon Driver - Time to Burn Rubber!
+	{"A9B", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Medabots - Rokusho Version
+	{"A9C", 0, SaveType::NONE, 0, 0}, // NONE}            CT Special Forces 2 - Back in the Trenches
+	{"A9D", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Doom II
+	{"A9G", 0, SaveType::NONE, 0, 0}, // NONE}            Stadium Games
+	{"A9H", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Dragon Quest Monsters - Caravan Heart
+	{"A9K", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Slime Morimori Dragon Quest - Shougeki no Shippo Dan
+	{"A9L", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Tennis no Ouji-sama 2003 - Cool Blue
+	{"A9M", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Moto Racer Advance
+	{"A9N", 0, SaveType::NONE, 0, 0}, // NONE}            Piglet's Big Game
+	{"A9P", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Tales of the World - Summoner's Lineage
+	{"A9Q", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Kururin Paradise
+	{"A9R", 0, SaveType::NONE, 0, 0}, // NONE}            Road Rash - Jailbreak
+	{"A9S", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Dancing Sword - Senkou
+	{"A9T", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Metal Max 2 - Kai Version
+	{"AA2", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Super Mario World - Super Mario Advance 2
+	{"AA3", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       All-Star Baseball 2003
+	{"AA4", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Monster Maker 4 - Flash Card
+	{"AA5", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Monster Maker 4 - Killer Dice
+	{"AA6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The Sum of All Fears
+	{"AA7", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       All-Star Baseball 2004
+	{"AA9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Duel Masters - Sempai Legends
+	{"AAB", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     American Bass Challenge
+	{"AAD", 0, SaveType::NONE, 0, 0}, // NONE}            Donald Duck Advance
+	{"AAE", 0, SaveType::NONE, 0, 0}, // NONE}            Hey Arnold! - The Movie
+	{"AAG", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Angelique
+	{"AAH", 0, SaveType::NONE, 0, 0}, // NONE}            Secret Agent Barbie - Royal Jewels Mission
+	{"AAI", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Gachasute! Dino Device - Red
+	{"AAJ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Sin Kisekae Monogatari
+	{"AAK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Air Force Delta Storm
+	{"AAL", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Kidou Tenshi Angelic Layer - Misaki to Yume no Tenshi-tachi
+	{"AAM", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Castlevania - Circle of the Moon
+	{"AAN", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Animal Mania - DokiDoki Aishou Check
+	{"AAO", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Aero the Acro-Bat - Rascal Rival Revenge
+	{"AAP", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Metalgun Slinger
+	{"AAQ", 0, SaveType::NONE, 0, 0}, // NONE}            Animal Snap - Rescue Them 2 By 2
+	{"AAR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Altered Beast - Guardian of the Realms
+	{"AAS", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     World Advance Soccer - Shouri heno Michi
+	{"AAT", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Family Tennis Advance
+	{"AAU", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Shin Megami Tensei
+	{"AAV", 0, SaveType::NONE, 0, 0}, // NONE}            Atari Anniversary Advance
+	{"AAW", 0, SaveType::NONE, 0, 0}, // NONE}            Contra Advance - The Alien Wars EX
+	{"AAX", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Fantastic Maerchen - Cake-yasan Monogatari
+	{"AAY", 0, SaveType::NONE, 0, 0}, // NONE}            Mary-Kate and Ashley Sweet 16 - Licensed to Drive
+	{"AAZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Ao-Zoura to Nakamatachi - Yume no Bouken
+	{"AB2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Breath of Fire II
+	{"AB3", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Dave Mirra Freestyle BMX 3
+	{"AB4", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Summon Night - Swordcraft Story
+	{"AB6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Black Belt Challenge
+	{"AB7", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Minna no Shiiku Series 1 - Boku no Kabuto Mushi
+	{"AB8", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Bakuten Shoot Beyblade 2002 - Ikuze! Bakutou! Chou Jiryoku Battle!!
+	{"AB9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Dual Blades
+	{"ABC", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Boku ha Koukuu Kanseikan
+	{"ABD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Boulder Dash EX
+	{"ABE", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     BattleBots - Beyond the BattleBox
+	{"ABF", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Breath of Fire
+	{"ABG", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Sweet Cookie Pie
+	{"ABI", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Gachasute! Dino Device - Blue
+	{"ABJ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Broken Sword - The Shadow of the Templars
+	{"ABK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     BackTrack
+	{"ABM", 0, SaveType::NONE, 0, 0}, // NONE}            Super Bust-A-Move
+	{"ABN", 0, SaveType::NONE, 0, 0}, // NONE}            NBA Jam 2002
+	{"ABO", 0, SaveType::NONE, 0, 0}, // NONE}            Boxing Fever
+	{"ABP", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Baseball Advance
+	{"ABQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     David Beckham Soccer
+	{"ABR", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Blender Bros.
+	{"ABS", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Bomberman Tournament
+	{"ABT", 0, SaveType::NONE, 0, 0}, // NONE}            Batman Vengeance
+	{"ABU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Ultimate Brain Games
+	{"ABV", 0, SaveType::NONE, 0, 0}, // NONE}            Maya the Bee - The Great Adventure
+	{"ABW", 0, SaveType::NONE, 0, 0}, // NONE}            Butt-Ugly Martians - B.K.M. Battles
+	{"ABY", 0, SaveType::NONE, 0, 0}, // NONE}            Britney's Dance Beat
+	{"ABZ", 0, SaveType::NONE, 0, 0}, // NONE}            NFL Blitz 20-02
+	{"AC2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       J.League Pro Soccer Club wo Tsukurou! Advance
+	{"AC4", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Meitantei Conan - Nerawareta Tantei
+	{"AC5", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       DemiKids - Dark Version
+	{"AC6", 0, SaveType::NONE, 0, 0}, // NONE}            Spirit - Stallion of the Cimarron
+	{"AC7", 0, SaveType::NONE, 0, 0}, // NONE}            CT Special Forces
+	{"AC8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Crash Bandicoot 2 - N-Tranced
+	{"AC9", 0, SaveType::NONE, 0, 0}, // NONE}            Cartoon Network Block Party
+	{"ACA", 0, SaveType::NONE, 0, 0}, // NONE}            GT Advance - Championship Racing
+	{"ACB", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Car Battler Joe
+	{"ACC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Crazy Chase
+	{"ACE", 0, SaveType::NONE, 0, 0}, // NONE}            Agassi Tennis Generation
+	{"ACF", 0, SaveType::NONE, 0, 0}, // NONE}            Cruis'n Velocity
+	{"ACG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Columns Crown
+	{"ACH", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Castlevania - Harmony of Dissonance
+	{"ACI", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     WTA Tour Tennis Pocket
+	{"ACJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Chou Makai-Mura R
+	{"ACK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Backyard Baseball
+	{"ACL", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Sakura Momoko no UkiUki Carnival
+	{"ACM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Colin McRae Rally 2.0
+	{"ACO", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Manga-ka Debut Monogatari
+	{"ACP", 0, SaveType::NONE, 0, 0}, // NONE}            Caesars Palace Advance
+	{"ACQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Crash Bandicoot - The Huge Adventure
+	{"ACR", 0, SaveType::Flash_512k_Atmel, 0, 0}, // FLASH_V121      Chu Chu Rocket!
+	{"ACS", 0, SaveType::NONE, 0, 0}, // NONE}            Casper
+	{"ACT", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Creatures
+	{"ACU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Crash Bandicoot Advance
+	{"ACV", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Robopon 2 - Cross Version
+	{"ACX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Cubix - Robots for Everyone - Clash 'N Bash
+	{"ACY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Chessmaster
+	{"ACZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Comix Zone
+	{"AD2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V100       Mr. Driller 2
+	{"AD3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Dinotopia - The Timestone Pirates
+	{"AD4", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Dungeons & Dragons - Eye of the Beholder
+	{"AD5", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Mr. Driller A - Fushigi na Pacteria
+	{"AD6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Davis Cup
+	{"AD7", 0, SaveType::NONE, 0, 0}, // NONE}            Droopy's Tennis Open
+	{"AD9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Duke Nukem Advance
+	{"ADA", 0, SaveType::NONE, 0, 0}, // NONE}            Dark Arena
+	{"ADB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Denki Blocks!
+	{"ADC", 0, SaveType::NONE, 0, 0}, // NONE}            Fruit Chase
+	{"ADD", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Diadroids World - Evil Teikoku no Yabou
+	{"ADE", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Adventure of Tokyo Disney Sea
+	{"ADF", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Super Dodge Ball Advance
+	{"ADH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Defender of the Crown
+	{"ADI", 0, SaveType::NONE, 0, 0}, // NONE}            Desert Strike Advance
+	{"ADK", 0, SaveType::NONE, 0, 0}, // NONE}            Donald Duck Advance
+	{"ADL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Dexter's Laboratory - Deesaster Strikes!
+	{"ADM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Doom
+	{"ADN", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Jurassic Park III - The DNA Factor
+	{"ADO", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Domo-kun no Fushigi Terebi
+	{"ADP", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Doraemon - Dokodemo Walker
+	{"ADQ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Dokapon
+	{"ADR", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Doraemon - Midori no Wakusei DokiDoki Daikyuushutsu!
+	{"ADS", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Daisenryaku for GameBoy Advance
+	{"ADU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Driver 2 Advance
+	{"ADV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Driven
+	{"ADW", 0, SaveType::NONE, 0, 0}, // NONE}            Downforce
+	{"ADX", 0, SaveType::NONE, 0, 0}, // NONE}            Dexter's Laboratory - Chess Challenge
+	{"ADY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Hanafuda Trump Mahjong - Depachika Wayouchuu
+	{"ADZ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Dragon Ball Z - Collectible Card Game
+	{"AE2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       MegaMan Battle Network 2
+	{"AE3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Ed, Edd n Eddy - Jawbreakers!
+	{"AE7", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Fire Emblem
+	{"AEA", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Snap Kid's
+	{"AEC", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Samurai Evolution - Oukoku Geist
+	{"AED", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Carrera Power Slide
+	{"AEE", 0, SaveType::NONE, 0, 0}, // NONE}            Ballistic - Ecks vs Sever
+	{"AEG", 0, SaveType::NONE, 0, 0}, // NONE}            Extreme Ghostbusters - Code Ecto-1
+	{"AEH", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Puzzle & Tantei Collection
+	{"AEJ", 0, SaveType::NONE, 0, 0}, // NONE}            Earthworm Jim
+	{"AEK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Elemix!
+	{"AEL", 0, SaveType::NONE, 0, 0}, // NONE}            European Super League
+	{"AEM", 0, SaveType::NONE, 0, 0}, // NONE}            Egg Mania
+	{"AEN", 0, SaveType::NONE, 0, 0}, // NONE}            Serious Sam Advance
+	{"AEP", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Sheep
+	{"AER", 0, SaveType::NONE, 0, 0}, // NONE}            Dora the Explorer - The Search for the Pirate Pig's Treasure
+	{"AES", 0, SaveType::NONE, 0, 0}, // NONE}            Ecks vs Sever
+	{"AET", 0, SaveType::NONE, 0, 0}, // NONE}            E.T. - The Extra-Terrestrial
+	{"AEV", 0, SaveType::NONE, 0, 0}, // NONE}            Alienators - Evolution Continues
+	{"AEW", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Ui-Ire - World Soccer Winning Eleven
+	{"AEX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The King of Fighters EX2 - Howling Blood
+	{"AEY", 0, SaveType::NONE, 0, 0}, // NONE}            Kim Possible - Revenge of Monkey Fist
+	{"AF3", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Zero One
+	{"AF4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Fushigi no Kuni no Alice
+	{"AF5", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Shining Force - Resurrection of the Dark Dragon
+	{"AF6", 0, SaveType::NONE, 0, 0}, // NONE}            The Fairly Odd Parents! - Breakin' da Rules
+	{"AF7", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Tokimeki Yume Series 1 - Ohanaya-san ni Narou!
+	{"AF8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     F1 2002
+	{"AF9", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Field of Nine - Digital Edition 2001
+	{"AFA", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Fushigi no Kuni no Angelique
+	{"AFB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Frogger's Adventures 2 - The Lost Wand
+	{"AFC", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     RockMan & Forte
+	{"AFE", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Fire Emblem - Fuuin no Tsurugi
+	{"AFF", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Final Fight One
+	{"AFG", 0, SaveType::NONE, 0, 0}, // NONE}            An American Tail - Fievel's Gold Rush
+	{"AFH", 0, SaveType::NONE, 0, 0}, // NONE}            Strike Force Hydra
+	{"AFJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     FIFA 2003
+	{"AFL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     FILA Decathlon
+	{"AFM", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Formation Soccer 2002
+	{"AFN", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Angel Collection - Mezase! Gakuen no Fashion Leader
+	{"AFO", 0, SaveType::NONE, 0, 0}, // NONE}            Fortress
+	{"AFP", 0, SaveType::Flash_512k_Atmel, 0, 0}, // FLASH_V123      Fire Pro Wrestling
+	{"AFQ", 0, SaveType::NONE, 0, 0}, // NONE}            Frogger Advance - The Great Quest
+	{"AFR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Frogger's Adventures - Temple of the Frog
+	{"AFS", 0, SaveType::NONE, 0, 0}, // NONE}            The Flintstones - Big Trouble in Bedrock
+	{"AFT", 0, SaveType::NONE, 0, 0}, // NONE}            F-14 Tomcat
+	{"AFU", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Youkaidou
+	{"AFV", 0, SaveType::NONE, 0, 0}, // NONE}            The Fairly Odd Parents! - Enter the Cleft
+	{"AFW", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Final Fire Pro Wrestling - Yume no Dantai Unei!
+	{"AFX", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V130      Final Fantasy Tactics Advance
+	{"AFY", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Fire Pro Wrestling 2
+	{"AFZ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V111       F-Zero - Maximum Velocity
+	{"AG2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Kami no Kijutsu - Illusion of the Evil Eyes
+	{"AG4", 0, SaveType::NONE, 0, 0}, // NONE}            Godzilla - Domination!
+	{"AG5", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Super Ghouls 'N Ghosts
+	{"AG6", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Mugenborg
+	{"AG7", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Advance GTA
+	{"AG8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Galidor - Defenders of the Outer Dimension
+	{"AG9", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Greatest Nine
+	{"AGA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Gradius Galaxies
+	{"AGB", 0, SaveType::NONE, 0, 0}, // NONE}            GBA-SP AV Adaptor
+	{"AGC", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Guru Logic Champ
+	{"AGD", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Lufia - The Ruins of Lore
+	{"AGE", 0, SaveType::NONE, 0, 0}, // NONE}            Gekido Advance - Kintaro's Revenge
+	{"AGF", 0, SaveType::Flash_512k_Atmel, 0, 0}, // FLASH_V123      Golden Sun - The Lost Age
+	{"AGG", 0, SaveType::NONE, 0, 0}, // NONE}            Gremlins - Stripe vs Gizmo
+	{"AGH", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Medarot G - Kabuto Version
+	{"AGI", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Medarot G - Kuwagata Version
+	{"AGK", 0, SaveType::NONE, 0, 0}, // NONE}            Gensou Suikoden - Card Stories
+	{"AGL", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Tomato Adventure
+	{"AGM", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V124      JGTO Kounin Golf Master Mobile - Japan Golf Tour Game
+	{"AGN", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V121     Goemon - New Age Shutsudou!
+	{"AGO", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Kurohige no Golf Shiyouyo
+	{"AGP", 0, SaveType::NONE, 0, 0}, // NONE}            No Rules - Get Phat
+	{"AGQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Go! Go! Beckham! - Adventure on Soccer Island
+	{"AGR", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V124      ESPN Final Round Golf 2002
+	{"AGS", 0, SaveType::Flash_512k_Atmel, 0, 0}, // FLASH_V123      Golden Sun
+	{"AGT", 0, SaveType::Flash_512k_Atmel, 0, 0}, // FLASH_V121      Zen-Nippon GT Senshuken
+	{"AGU", 0, SaveType::NONE, 0, 0}, // NONE}            Masters of the Universe - He-Man Power of Grayskull
+	{"AGV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Ghost Trap
+	{"AGW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     GT Advance 2 - Rally Racing
+	{"AGX", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V124      Guilty Gear X - Advance Edition
+	{"AGZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Galaxy Angel GameBoy Advance
+	{"AH2", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Mat Hoffman's Pro BMX 2
+	{"AH3", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Hamtaro - Ham-Ham Heartbreak
+	{"AH4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Shrek - Hassle at the Castle
+	{"AH5", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Beast Shooter - Mezase Beast King!
+	{"AH6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Hardcore Pinball
+	{"AH7", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Nakayoshi Pet Advance Series 1 - Kawaii Hamster
+	{"AH8", 0, SaveType::NONE, 0, 0}, // NONE}            Hot Wheels - Velocity X
+	{"AH9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The Hobbit
+	{"AHA", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Hamster Paradise Advance
+	{"AHB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Hamster Monogatari 2 GBA
+	{"AHC", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Minimoni - Mika no Happy Morning Chatty
+	{"AHE", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Bakuten Shoot Beyblade - Gekitou! Saikyou Blader
+	{"AHH", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     High Heat - Major League Baseball 2003
+	{"AHI", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Hitsuji no Kimochi
+	{"AHJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Hugo - The Evil Mirror
+	{"AHK", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Hikaru no Go
+	{"AHL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The Incredible Hulk
+	{"AHM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Dai-Mahjong
+	{"AHN", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     SpyHunter
+	{"AHO", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Mat Hoffman's Pro BMX
+	{"AHP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Hot Potato!
+	{"AHQ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Harobots - Robo Hero Battling!!
+	{"AHR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Harry Potter and the Sorcerer's Stone
+	{"AHS", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Hatena Satena
+	{"AHT", 0, SaveType::NONE, 0, 0}, // NONE}            Hikaru no Go - Taikenban
+	{"AHU", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V130      Shining Soul
+	{"AHV", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Nakayoshi Youchien - Sukoyaka Enji Ikusei Game
+	{"AHW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Hot Wheels - Burnin' Rubber
+	{"AHX", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     High Heat - Major League Baseball 2003
+	{"AHZ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Higanbana
+	{"AI2", 0, SaveType::NONE, 0, 0}, // NONE}            Iridion II
+	{"AI3", 0, SaveType::NONE, 0, 0}, // NONE}            Iridion 3D
+	{"AI7", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Nakayoshi Pet Advance Series 2 - Kawaii Koinu
+	{"AI8", 0, SaveType::NONE, 0, 0}, // NONE}            Barbie Horse Adventures - Blue Ribbon Race
+	{"AI9", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Inukko Club
+	{"AIA", 0, SaveType::NONE, 0, 0}, // NONE}            Ice Age
+	{"AIB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Guranbo
+	{"AIC", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Oshaberi Inko Club
+	{"AID", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Space Invaders
+	{"AIE", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Isseki Hattyou - Kore 1ppon de 8syurui!
+	{"AIF", 0, SaveType::NONE, 0, 0}, // NONE}            Tom and Jerry in Infurnal Escape
+	{"AIG", 0, SaveType::NONE, 0, 0}, // NONE}            Inspector Gadget - Advance Mission
+	{"AIH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Mission Impossible - Operation Surma
+	{"AIK", 0, SaveType::NONE, 0, 0}, // NONE}            International Karate Advanced
+	{"AIL", 0, SaveType::NONE, 0, 0}, // NONE}            Aggressive Inline
+	{"AIN", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Initial D - Another Stage
+	{"AIO", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     The Invincible Iron Man
+	{"AIP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Silent Scope
+	{"AIR", 0, SaveType::NONE, 0, 0}, // NONE}            Inspector Gadget Racing
+	{"AIS", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V120     International Superstar Soccer
+	{"AIV", 0, SaveType::NONE, 0, 0}, // NONE}            Invader
+	{"AIY", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Inuyasha - Naraku no Wana! Mayoi no Mori no Shoutaijou
+	{"AJ2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       J.League Pocket 2
+	{"AJ3", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Jurassic Park III - Park Builder
+	{"AJ4", 0, SaveType::NONE, 0, 0}, // NONE}            Earthworm Jim 2
+	{"AJ6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Aladdin
+	{"AJ8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Jurassic Park Institute Tour - Dinosaur Rescue
+	{"AJ9", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Super Robot Taisen R
+	{"AJA", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Monster Jam - Maximum Destruction
+	{"AJC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Jackie Chan Adventures - Legend of the Darkhand
+	{"AJD", 0, SaveType::NONE, 0, 0}, // NONE}            James Pond - Codename Robocod
+	{"AJE", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Fancy Pocket
+	{"AJF", 0, SaveType::NONE, 0, 0}, // NONE}            The Jungle Book
+	{"AJG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Tarzan - Return to the Jungle
+	{"AJH", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Petz - Hamsterz Life 2
+	{"AJJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Jazz Jackrabbit
+	{"AJK", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Jikkyou World Soccer Pocket 2
+	{"AJL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Justice League - Injustice for All
+	{"AJM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Jonny Moseley Mad Trix
+	{"AJN", 0, SaveType::NONE, 0, 0}, // NONE}            Jimmy Neutron - Boy Genius
+	{"AJO", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Magical Houshin
+	{"AJP", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       J.League Pocket
+	{"AJQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Jurassic Park III - Island Attack
+	{"AJR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Jet Set Radio
+	{"AJS", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V111       Space Hexcite - Maetel Legend EX
+	{"AJT", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Samurai Jack - The Amulet of Time
+	{"AJU", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Jissen Pachi-Slot Hisshouhou! - Juuou Advance
+	{"AJW", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Jikkyou World Soccer Pocket
+	{"AJX", 0, SaveType::NONE, 0, 0}, // NONE}            The Adventures of Jimmy Neutron vs Jimmy Negatron
+	{"AJY", 0, SaveType::NONE, 0, 0}, // NONE}            Drake & Josh
+	{"AJZ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Bomberman Jetters
+	{"AK2", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Ultimate Muscle - The Kinnikuman Legacy - The Path of the Superhero
+	{"AK3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Turbo Turtle Adventure
+	{"AK4", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Kinniku Banzuke - Kongou-kun no Daibouken!
+	{"AK5", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Kinniku Banzuke - Kimero! Kiseki no Kanzen Seiha
+	{"AK6", 0, SaveType::NONE, 0, 0}, // NONE}            Soccer Kid
+	{"AK7", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Klonoa Heroes - Densetsu no Star Medal
+	{"AK8", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Medabots AX - Metabee Version
+	{"AK9", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Medabots AX - Rokusho Version
+	{"AKA", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Shaman King Card Game - Chou Senjiryakketsu 2
+	{"AKB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Sports Illustrated for Kids - Baseball
+	{"AKC", 0, SaveType::NONE, 0, 0}, // NONE}            Konami Collector's Series - Arcade Advanced
+	{"AKD", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Kaeru B Back
+	{"AKE", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Hikaru no Go 2
+	{"AKF", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Sports Illustrated for Kids - Football
+	{"AKG", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Mech Platoon
+	{"AKI", 0, SaveType::NONE, 0, 0}, // NONE}            Kiki KaiKai Advance
+	{"AKK", 0, SaveType::NONE, 0, 0}, // NONE}            Kao the Kangaroo
+	{"AKL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Klonoa - Empire of Dreams
+	{"AKM", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Kiwame Mahjong Deluxe - Mirai Senshi 21
+	{"AKO", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The King of Fighters EX - Neo Blood
+	{"AKP", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Nakayoshi Mahjong - Kaburiichi
+	{"AKQ", 0, SaveType::NONE, 0, 0}, // NONE}            Kong - The Animated Series
+	{"AKR", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V111       Kurukuru Kururin
+	{"AKS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Mary-Kate and Ashley - Girls Night Out
+	{"AKT", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V121     Hello Kitty Collection - Miracle Fashion Maker
+	{"AKU", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Kurohige no Kurutto Jintori
+	{"AKV", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     K-1 Pocket Grand Prix
+	{"AKW", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V111       Konami Krazy Racers
+	{"AKX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Spider-Man
+	{"AKY", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Captain Tsubasa - Eikou no Kiseki
+	{"AKZ", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Kamaitachi no Yoru Advance
+	{"AL2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       LEGO Island 2 - The Brickster's Revenge
+	{"AL3", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Shaman King Card Game - Chou Senjiryakketsu 3
+	{"AL4", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       DemiKids - Light Version
+	{"AL9", 0, SaveType::NONE, 0, 0}, // NONE}            Tomb Raider - The Prophecy
+	{"ALA", 0, SaveType::NONE, 0, 0}, // NONE}            The Land Before Time
+	{"ALB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       LEGO Bionicle
+	{"ALC", 0, SaveType::NONE, 0, 0}, // NONE}            Little League Baseball 2002
+	{"ALD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Lady Sia
+	{"ALE", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Bruce Lee - Return of the Legend
+	{"ALF", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Dragon Ball Z - The Legacy of Goku II
+	{"ALG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Dragon Ball Z - The Legacy of Goku
+	{"ALH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Love Hina Advance - Shukufuku no Kane ha Naru Kana
+	{"ALI", 0, SaveType::NONE, 0, 0}, // NONE}            The Haunted Mansion
+	{"ALJ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Sea Trader - Rise of Taipan
+	{"ALL", 0, SaveType::NONE, 0, 0}, // NONE}            Lucky Luke - Wanted!
+	{"ALM", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Pro Yakyuu Team wo Tsukurou! Advance
+	{"ALN", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Lunar Legend
+	{"ALO", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     The Lord of the Rings - The Fellowship of the Ring
+	{"ALP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The Lord of the Rings - The Two Towers
+	{"ALQ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Little Buster Q
+	{"ALR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     LEGO Racers 2
+	{"ALS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Soccer Mania
+	{"ALT", 0, SaveType::NONE, 0, 0}, // NONE}            Lilo & Stitch
+	{"ALU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Super Monkey Ball Jr.
+	{"ALV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The Lost Vikings
+	{"ALX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Ace Lightning
+	{"AM2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       MegaMan Battle Network 2
+	{"AM3", 0, SaveType::NONE, 0, 0}, // NONE}            Midway's Greatest Arcade Hits
+	{"AM4", 0, SaveType::NONE, 0, 0}, // NONE}            Moto GP
+	{"AM5", 0, SaveType::NONE, 0, 0}, // NONE}            Mortal Kombat Advance
+	{"AM6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Mike Tyson Boxing
+	{"AM7", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Hamepane - Tokyo Mew Mew
+	{"AM8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Monster Force
+	{"AM9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Mike Tyson Boxing
+	{"AMA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Super Mario Advance
+	{"AMB", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V124      Mobile Pro Yakyuu - Kantoku no Saihai
+	{"AMC", 0, SaveType::Flash_512k_Atmel, 0, 0}, // FLASH_V121      Mail de Cute
+	{"AME", 0, SaveType::NONE, 0, 0}, // NONE}            Army Men - Operation Green
+	{"AMF", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Monster Rancher Advance
+	{"AMG", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       ESPN Great Outdoor Games - Bass 2002
+	{"AMH", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V121     Bomberman Max 2 - Blue Advance
+	{"AMI", 0, SaveType::NONE, 0, 0}, // NONE}            Men in Black - The Series
+	{"AMJ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Tweety no Hearty Party
+	{"AMK", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V124      Mario Kart - Super Circuit
+	{"AML", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     M&M's Blast!
+	{"AMM", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Momotarou Matsuri
+	{"AMN", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Monster Guardians
+	{"AMO", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       EX Monopoly
+	{"AMP", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Mahjong Police
+	{"AMQ", 0, SaveType::NONE, 0, 0}, // NONE}            Midnight Club - Street Racing
+	{"AMR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Motocross Maniacs Advance
+	{"AMS", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Morita Shougi Advance
+	{"AMT", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Metroid Fusion
+	{"AMU", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Mutsu - Water Looper Mutsu
+	{"AMV", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Magical Vacation
+	{"AMW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Muppet Pinball Mayhem
+	{"AMX", 0, SaveType::NONE, 0, 0}, // NONE}            Monsters, Inc.
+	{"AMY", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V121     Bomberman Max 2 - Red Advance
+	{"AMZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Super Mario Advance (Kiosk Demo)
+	{"AN2", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Natural 2 - Duo
+	{"AN3", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Catz
+	{"AN4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     NHL Hitz 20-03
+	{"AN5", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Kawa no Nushi Tsuri 5 - Fushigi no Mori Kara
+	{"AN6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Klonoa 2 - Dream Champ Tournament
+	{"AN7", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Famista Advance
+	{"AN8", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Tales of Phantasia
+	{"AN9", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Tales of the World - Narikiri Dungeon 2
+	{"ANA", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V124      Medarot Navi - Kabuto
+	{"ANB", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V125      Nobunaga no Yabou
+	{"ANC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     ZooCube
+	{"AND", 0, SaveType::NONE, 0, 0}, // NONE}            Nancy Drew - Message in a Haunted Mansion
+	{"ANF", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Monster Gate
+	{"ANH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     NASCAR Heat 2002
+	{"ANI", 0, SaveType::NONE, 0, 0}, // NONE}            Animaniacs - Lights, Camera, Action!
+	{"ANJ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Madden NFL 2003
+	{"ANK", 0, SaveType::NONE, 0, 0}, // NONE}            NFL Blitz 20-03
+	{"ANL", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     NHL 2002
+	{"ANM", 0, SaveType::NONE, 0, 0}, // NONE}            Namco Museum
+	{"ANN", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Gekitou Densetsu Noah - Dream Management
+	{"ANO", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Nobunaga Ibun
+	{"ANP", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Napoleon
+	{"ANQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Nicktoons Racing
+	{"ANR", 0, SaveType::NONE, 0, 0}, // NONE}            Cartoon Network Speedway
+	{"ANS", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Marie, Elie & Anis no Atelier - Soyokaze Kara no Dengon
+	{"ANT", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Nippon Pro Mahjong Renmei Kounin - Tetsuman Advance
+	{"ANU", 0, SaveType::NONE, 0, 0}, // NONE}            Antz - Extreme Racing
+	{"ANV", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Shiren Monsters - Netsal
+	{"ANW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Elevator Action - Old & New
+	{"ANX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Ninja Five-O
+	{"ANY", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Gachinko Pro Yakyuu
+	{"ANZ", 0, SaveType::NONE, 0, 0}, // NONE}            Antz - Extreme Racing
+	{"AO2", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Oshare Princess 2
+	{"AO3", 0, SaveType::NONE, 0, 0}, // NONE}            Terminator 3 - Rise of the Machines
+	{"AO4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Tom Clancy's Splinter Cell
+	{"AO7", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       One Piece - Nanatsu Shima no Daihihou
+	{"AOB", 0, SaveType::NONE, 0, 0}, // NONE}            Asterix & Obelix - Bash Them All!
+	{"AOC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Chobits for GameBoy Advance
+	{"AOD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Minami no Umi no Odyssey
+	{"AOE", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Drome Racers
+	{"AOG", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V130      Super Robot Taisen - Original Generation
+	{"AOH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Minimoni - Onegai Ohoshi-sama!
+	{"AOI", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Shrek - Reekin' Havoc
+	{"AOK", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Okumanchouja Game - Nottori Daisakusen!
+	{"AOM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Disney Sports - Motocross
+	{"AON", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Bubble Bobble - Old & New
+	{"AOP", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Oshare Princess
+	{"AOR", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Oriental Blue - Ao no Tengai
+	{"AOS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Samurai Deeper Kyo
+	{"AOT", 0, SaveType::NONE, 0, 0}, // NONE}            Polly! Pocket - Super Splash Island
+	{"AOW", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Spyro - Attack of the Rhynocs
+	{"AP3", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Power Pro Kun Pocket 3
+	{"AP4", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Power Pro Kun Pocket 4
+	{"AP5", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The Powerpuff Girls - Him and Seek
+	{"AP6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Pinobee & Phoebee
+	{"AP7", 0, SaveType::NONE, 0, 0}, // NONE}            Pink Panther - Pinkadelic Pursuit
+	{"AP8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Scooby-Doo - The Motion Picture
+	{"AP9", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Pocket Music
+	{"APB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V111       Pinobee - Wings of Adventure
+	{"APC", 0, SaveType::NONE, 0, 0}, // NONE}            Pac-Man Collection
+	{"APD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The Pinball of the Dead
+	{"APE", 0, SaveType::NONE, 0, 0}, // NONE}            Pink Panther - Pinkadelic Pursuit
+	{"APF", 0, SaveType::NONE, 0, 0}, // NONE}            Pitfall - The Mayan Adventure
+	{"APG", 0, SaveType::NONE, 0, 0}, // NONE}            Punch King - Arcade Boxing
+	{"APH", 0, SaveType::NONE, 0, 0}, // NONE}            Prehistorik Man
+	{"API", 0, SaveType::NONE, 0, 0}, // NONE}            Pinky and the Brain - The Masterplan
+	{"APJ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Bouken Yuuki Pluster World - Densetsu no PlustoGate
+	{"APK", 0, SaveType::NONE, 0, 0}, // NONE}            Pocky & Rocky with Becky
+	{"APL", 0, SaveType::NONE, 0, 0}, // NONE}            Pinball Challenge Deluxe
+	{"APM", 0, SaveType::NONE, 0, 0}, // NONE}            Planet Monsters
+	{"APN", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Pinky Monkey Town
+	{"APO", 0, SaveType::NONE, 0, 0}, // NONE}            Popeye - Rush for Spinach
+	{"APP", 0, SaveType::NONE, 0, 0}, // NONE}            Peter Pan - Return to Neverland
+	{"APR", 0, SaveType::NONE, 0, 0}, // NONE}            Power Rangers - Time Force
+	{"APT", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The Powerpuff Girls - Mojo Jojo A-Go-Go
+	{"APU", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     PukuPuku Tennen Kairanban
+	{"APW", 0, SaveType::NONE, 0, 0}, // NONE}            Power Rangers - Wild Force
+	{"APX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Phalanx - The Enforce Fighter A-144
+	{"APY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Puyo Pop
+	{"APZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Pinball Advance
+	{"AQ2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Gadget Racers
+	{"AQ3", 0, SaveType::NONE, 0, 0}, // NONE}            SpongeBob SquarePants - Revenge of the Flying Dutchman
+	{"AQA", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Gadget Racers
+	{"AQB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Scrabble
+	{"AQC", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Combat Choro Q - Advance Daisakusen
+	{"AQD", 0, SaveType::NONE, 0, 0}, // NONE}            Crouching Tiger Hidden Dragon
+	{"AQH", 0, SaveType::NONE, 0, 0}, // NONE}            Rescue Heroes - Billy Blazes!
+	{"AQM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Magical Quest 2 Starring Mickey & Minnie
+	{"AQP", 0, SaveType::NONE, 0, 0}, // NONE}            Disney Princess
+	{"AQR", 0, SaveType::NONE, 0, 0}, // NONE}            ATV Quad Power Racing
+	{"AQT", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Dr. Seuss' - The Cat in the Hat
+	{"AQW", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Game & Watch Gallery 4
+	{"AQX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Blackthorne
+	{"AR2", 0, SaveType::NONE, 0, 0}, // NONE}            Ready 2 Rumble Boxing - Round 2
+	{"AR3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Ice Nine
+	{"AR4", 0, SaveType::NONE, 0, 0}, // NONE}            Rocket Power - Beach Bandits
+	{"AR5", 0, SaveType::NONE, 0, 0}, // NONE}            Rugrats - I Gotta Go Party
+	{"AR6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Tom Clancy's Rainbow Six - Rogue Spear
+	{"AR7", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Advance Rally
+	{"AR8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Rocky
+	{"AR9", 0, SaveType::NONE, 0, 0}, // NONE}            Reign of Fire
+	{"ARA", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Shin Nippon Pro Wrestling Toukon Retsuden Advance
+	{"ARB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Robotech - The Macross Saga
+	{"ARD", 0, SaveType::NONE, 0, 0}, // NONE}            The Ripping Friends
+	{"ARE", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       MegaMan Battle Network
+	{"ARF", 0, SaveType::NONE, 0, 0}, // NONE}            Razor Freestyle Scooter
+	{"ARG", 0, SaveType::NONE, 0, 0}, // NONE}            Rugrats - Castle Capers
+	{"ARH", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Recca no Honoo - The Game
+	{"ARI", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Groove Adventure Rave - Hikari to Yami no Daikessen 2
+	{"ARJ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Custom Robo GX
+	{"ARK", 0, SaveType::NONE, 0, 0}, // NONE}            Rocket Power - Dream Scheme
+	{"ARM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Minority Report
+	{"ARN", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Harukanaru Toki no Naka de
+	{"ARO", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Rocky
+	{"ARP", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Robopon 2 - Ring Version
+	{"ARQ", 0, SaveType::NONE, 0, 0}, // NONE}            Matchbox Cross Town Heroes
+	{"ARS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Robot Wars - Extreme Destruction
+	{"ARU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Robot Wars - Advanced Destruction
+	{"ARV", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Groove Adventure Rave - Hikari to Yami no Daikessen
+	{"ARW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Robot Wars - Advanced Destruction
+	{"ARX", 0, SaveType::NONE, 0, 0}, // NONE}            Rampage - Puzzle Attack
+	{"ARY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V111     Rayman Advance
+	{"ARZ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       RockMan Zero
+	{"AS2", 0, SaveType::NONE, 0, 0}, // NONE}            Star Wars Episode II - Attack of the Clones
+	{"AS3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Kelly Slater's Pro Surfer
+	{"AS4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Shrek - Swamp Kart Speedway
+	{"AS5", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Salt Lake 2002
+	{"AS6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Speedball 2 - Brutal Deluxe
+	{"AS8", 0, SaveType::NONE, 0, 0}, // NONE}            Star X
+	{"ASA", 0, SaveType::NONE, 0, 0}, // NONE}            Army Men Advance
+	{"ASB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Gyakuten Saiban
+	{"ASC", 0, SaveType::NONE, 0, 0}, // NONE}            Shaun Palmer's Pro Snowboarder
+	{"ASD", 0, SaveType::NONE, 0, 0}, // NONE}            Scooby-Doo and the Cyber Chase
+	{"ASE", 0, SaveType::NONE, 0, 0}, // NONE}            Spider-Man - Mysterio's Menace
+	{"ASF", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Slot! Pro Advance - Takarabune & Ooedo Sakurafubuki 2
+	{"ASG", 0, SaveType::NONE, 0, 0}, // NONE}            Smuggler's Run
+	{"ASH", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Play Novel - Silent Hill
+	{"ASI", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     The Sims - Bustin' Out
+	{"ASK", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Sutakomi - Star Communicator
+	{"ASL", 0, SaveType::NONE, 0, 0}, // NONE}            Stuart Little 2
+	{"ASM", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Saibara Rieko no Dendou Mahjong
+	{"ASN", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Sansara Naga 1x2
+	{"ASO", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Sonic Advance
+	{"ASP", 0, SaveType::NONE, 0, 0}, // NONE}            SpongeBob SquarePants - SuperSponge
+	{"ASQ", 0, SaveType::NONE, 0, 0}, // NONE}            Snood
+	{"ASR", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V125      Super Robot Taisen A
+	{"ASS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     High Heat - Major League Baseball 2002
+	{"AST", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Densetsu no Stafi
+	{"ASU", 0, SaveType::NONE, 0, 0}, // NONE}            Superman - Countdown to Apokolips
+	{"ASV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Shanghai Advance
+	{"ASW", 0, SaveType::NONE, 0, 0}, // NONE}            Star Wars - Jedi Power Battles
+	{"ASX", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      San Goku Shi
+	{"ASY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Spyro - Season of Ice
+	{"ASZ", 0, SaveType::NONE, 0, 0}, // NONE}            The Scorpion King - Sword of Osiris
+	{"AT2", 0, SaveType::Flash_512k_Atmel, 0, 0}, // FLASH_V121      Dragon Quest Characters - Torneko no Daibouken 2 Advance
+	{"AT3", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Tony Hawk's Pro Skater 3
+	{"AT4", 0, SaveType::NONE, 0, 0}, // NONE}            Turok Evolution
+	{"AT5", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Tiger Woods PGA Tour Golf
+	{"AT6", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Tony Hawk's Pro Skater 4
+	{"AT7", 0, SaveType::NONE, 0, 0}, // NONE}            Tootuff - The Gagmachine
+	{"AT8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Tennis Masters Series 2003
+	{"AT9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     BMX Trick Racer
+	{"ATA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Tang Tang
+	{"ATB", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Slot! Pro 2 Advance - GoGo Juggler & New Tairyou
+	{"ATC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     TopGear GT Championship
+	{"ATD", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Daisuki Teddy
+	{"ATE", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     WTA Tour Tennis
+	{"ATF", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Alex Ferguson's Player Manager 2002
+	{"ATG", 0, SaveType::NONE, 0, 0}, // NONE}            Top Gun - Firestorm Advance
+	{"ATH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V111     Tony Hawk's Pro Skater 2
+	{"ATI", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Tennis no Ouji-sama - Genius Boys Academy
+	{"ATJ", 0, SaveType::NONE, 0, 0}, // NONE}            Tom and Jerry - The Magic Ring
+	{"ATK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Tekken Advance
+	{"ATL", 0, SaveType::NONE, 0, 0}, // NONE}            Atlantis - The Lost Empire
+	{"ATM", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Tweety and the Magic Gems
+	{"ATN", 0, SaveType::NONE, 0, 0}, // NONE}            Thunderbirds - International Rescue
+	{"ATO", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Tactics Ogre - The Knight of Lodis
+	{"ATP", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Keitai Denjuu Telefang 2 - Power
+	{"ATQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     TOCA World Touring Cars
+	{"ATR", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Toyrobo Force
+	{"ATS", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Keitai Denjuu Telefang 2 - Speed
+	{"ATT", 0, SaveType::NONE, 0, 0}, // NONE}            Tiny Toon Adventures - Scary Dreams
+	{"ATU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Steven Gerrard's Total Soccer 2002
+	{"ATV", 0, SaveType::NONE, 0, 0}, // NONE}            Tir et But - Edition Champions du Monde
+	{"ATW", 0, SaveType::NONE, 0, 0}, // NONE}            Tetris Worlds
+	{"ATX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     NGT - Next Generation Tennis
+	{"ATY", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Gambler Densetsu Tetsuya - Yomigaeru Densetsu
+	{"ATZ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Zoids Saga
+	{"AU2", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Shining Soul II
+	{"AU3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Moorhen 3 - The Chicken Chase!
+	{"AUC", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Uchuu Daisakusen Choco Vader - Uchuu Kara no Shinryakusha
+	{"AUE", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Naruto - Konoha Senki
+	{"AUG", 0, SaveType::NONE, 0, 0}, // NONE}            Medal of Honor - Underground
+	{"AUM", 0, SaveType::NONE, 0, 0}, // NONE}            The Mummy
+	{"AUQ", 0, SaveType::NONE, 0, 0}, // NONE}            Butt-Ugly Martians - B.K.M. Battles
+	{"AUS", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       One Piece - Mezase! King of Berries
+	{"AUT", 0, SaveType::NONE, 0, 0}, // NONE}            Tomb Raider - The Prophecy
+	{"AUX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Stuntman
+	{"AUY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Yuureiyashiki no Nijuuyojikan
+	{"AUZ", 0, SaveType::NONE, 0, 0}, // NONE}            Santa Claus Saves the Earth
+	{"AV3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Spy Kids 3-D - Game Over
+	{"AVA", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Tennis no Ouji-sama - Aim at the Victory!
+	{"AVB", 0, SaveType::NONE, 0, 0}, // NONE}            Barbie Groovy Games
+	{"AVC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Corvette
+	{"AVD", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Legend of Dynamic - Goushouden - Houkai no Rondo
+	{"AVE", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Ultimate Beach Soccer
+	{"AVF", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Densetsu no Stafi 2
+	{"AVI", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V124      Medarot Navi - Kuwagata
+	{"AVK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Virtual Kasparov
+	{"AVL", 0, SaveType::NONE, 0, 0}, // NONE}            Daredevil
+	{"AVM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     V-Master Cross
+	{"AVP", 0, SaveType::NONE, 0, 0}, // NONE}            V.I.P.
+	{"AVR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     V-Rally 3
+	{"AVS", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Sword of Mana
+	{"AVT", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Virtua Tennis
+	{"AVY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Buffy - Im Bann der Daemonen
+	{"AVZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Super Bubble Pop
+	{"AW2", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Advance Wars 2 - Black Hole Rising
+	{"AW3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Watashi no Makesalon
+	{"AW4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Mortal Kombat - Tournament Edition
+	{"AW7", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Minna no Shiiku Series 2 - Boku no Kuwagata
+	{"AW8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     WWE - Road to WrestleMania X8
+	{"AW9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Wing Commander - Prophecy
+	{"AWA", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Wario Land 4
+	{"AWB", 0, SaveType::NONE, 0, 0}, // NONE}            Worms Blast
+	{"AWC", 0, SaveType::NONE, 0, 0}, // NONE}            World Tennis Stars
+	{"AWD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Wakeboarding Unleashed featuring Shaun Murray
+	{"AWE", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Black Black - Bura Bura
+	{"AWF", 0, SaveType::NONE, 0, 0}, // NONE}            WWF - Road to WrestleMania
+	{"AWG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Salt Lake 2002
+	{"AWI", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     ESPN International Winter Sports 2002
+	{"AWK", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Wagamama Fairy Mirumo de Pon! - Ougon Maracas no Densetsu
+	{"AWL", 0, SaveType::NONE, 0, 0}, // NONE}            The Wild Thornberrys Movie
+	{"AWN", 0, SaveType::NONE, 0, 0}, // NONE}            Spirit & Spells
+	{"AWO", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Wolfenstein 3D
+	{"AWP", 0, SaveType::Flash_512k_Atmel, 0, 0}, // FLASH_V121      Winning Post for GameBoy Advance
+	{"AWQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Wings
+	{"AWR", 0, SaveType::Flash_512k_Atmel, 0, 0}, // FLASH_V121      Advance Wars
+	{"AWS", 0, SaveType::NONE, 0, 0}, // NONE}            Tiny Toon Adventures - Wacky Stackers
+	{"AWT", 0, SaveType::NONE, 0, 0}, // NONE}            The Wild Thornberrys - Chimp Chase
+	{"AWU", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Sabre Wulf
+	{"AWV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     X2 - Wolverine's Revenge
+	{"AWW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Woody Woodpecker in Crazy Castle 5
+	{"AWX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     ESPN Winter X-Games Snowboarding 2002
+	{"AWY", 0, SaveType::NONE, 0, 0}, // NONE}            Worms World Party
+	{"AWZ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Wizardry Summoner
+	{"AX2", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Dave Mirra Freestyle BMX 2
+	{"AX3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     xXx
+	{"AX4", 0, SaveType::Flash_1M_Macronix, 0, 0}, // FLASH_V102      Super Mario Advance 4 - Super Mario Bros. 3
+	{"AXB", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Black Matrix Zero
+	{"AXD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Mortal Kombat - Deadly Alliance
+	{"AXH", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Dan Doh!! Xi
+	{"AXI", 0, SaveType::NONE, 0, 0}, // NONE}            X-bladez - Inline Skater
+	{"AXM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     X-Men - Reign of Apocalypse
+	{"AXP", 0, SaveType::Flash_1M_Macronix_RTC, GAME_RTC, 0}, // FLASH_V103      Pokemon - Sapphire Version
+	{"AXQ", 0, SaveType::NONE, 0, 0}, // NONE}            Taxi 3
+	{"AXR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Super Street Fighter II Turbo - Revival
+	{"AXS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     ESPN X-Games Skateboarding
+	{"AXT", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Island Xtreme Stunts
+	{"AXV", 0, SaveType::Flash_1M_Macronix_RTC, GAME_RTC, 0}, // FLASH_V103      Pokemon - Ruby Version
+	{"AXX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Santa Claus Jr. Advance
+	{"AXY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     SSX Tricky
+	{"AXZ", 0, SaveType::NONE, 0, 0}, // NONE}            Micro Machines
+	{"AY2", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     International Superstar Soccer Advance
+	{"AY3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V121     Army Men - Turf Wars
+	{"AY5", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Yu-Gi-Oh! The Eternal Duelist Soul
+	{"AY6", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Yu-Gi-Oh! Duel Monsters 6 Expert 2
+	{"AY7", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Yu-Gi-Oh! The Sacred Cards
+	{"AY8", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Yu-Gi-Oh! - Reshef of Destruction
+	{"AYA", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Dokodemo Taikyoku - Yakuman Advance
+	{"AYB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Backyard Basketball
+	{"AYC", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V120     Phantasy Star Collection
+	{"AYD", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Yu-Gi-Oh! Dungeon Dice Monsters
+	{"AYE", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     TopGear Rally
+	{"AYF", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Backyard Football
+	{"AYG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Gauntlet - Dark Legacy
+	{"AYH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Starsky & Hutch
+	{"AYI", 0, SaveType::NONE, 0, 0}, // NONE}            Urban Yeti!
+	{"AYK", 0, SaveType::NONE, 0, 0}, // NONE}            Karnaaj Rally
+	{"AYL", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Sega Rally Championship
+	{"AYM", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V100       Tanbi Musou - Meine Liebe
+	{"AYN", 0, SaveType::NONE, 0, 0}, // NONE}            Planet of the Apes
+	{"AYP", 0, SaveType::NONE, 0, 0}, // NONE}            Sega Arcade Gallery
+	{"AYR", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Narikiri Jockey Game - Yuushun Rhapsody
+	{"AYS", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Gakkou wo Tsukurou!! Advance
+	{"AYW", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Yu-Gi-Oh! Worldwide Edition - Stairway to the Destined Duel
+	{"AYZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Rayman 3
+	{"AZ2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Zoids - Legacy
+	{"AZ3", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Cyberdrive Zoids - Kijuu no Senshi Hyuu
+	{"AZ8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Super Puzzle Fighter II Turbo
+	{"AZ9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Simple 2960 Tomodachi Series Vol. 2 - The Block Kuzushi
+	{"AZA", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Azumanga Daiou Advance
+	{"AZB", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Bass Tsuri Shiyouze!
+	{"AZC", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       MegaMan Zero
+	{"AZD", 0, SaveType::NONE, 0, 0}, // NONE}            Zidane Football Generation
+	{"AZE", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V126      Zone of the Enders - The Fist of Mars
+	{"AZF", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Need for Speed - Porsche Unleashed
+	{"AZG", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Jinsei Game Advance
+	{"AZH", 0, SaveType::NONE, 0, 0}, // NONE}            Hugo - Bukkazoom!
+	{"AZI", 0, SaveType::NONE, 0, 0}, // NONE}            Finding Nemo
+	{"AZJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Dragon Ball Z - Supersonic Warriors
+	{"AZK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Simple 2960 Tomodachi Series Vol. 1 - The Table Game Collection
+	{"AZL", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     The Legend of Zelda - A Link to the Past & Four Swords
+	{"AZM", 0, SaveType::NONE, 0, 0}, // NONE}            The Muppets - On With the Show!
+	{"AZN", 0, SaveType::NONE, 0, 0}, // NONE}            Archer Maclean's Super Dropzone
+	{"AZO", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The Pinball of the Dead
+	{"AZP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Zapper
+	{"AZQ", 0, SaveType::NONE, 0, 0}, // NONE}            Treasure Planet
+	{"AZR", 0, SaveType::NONE, 0, 0}, // NONE}            Mr. Nutz
+	{"AZS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Gem Smashers
+	{"AZT", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V124      Zero-Tours
+	{"AZU", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Street Fighter Alpha 3 - Upper
+	{"AZW", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       WarioWare, Inc. - Mega Microgames!
+	{"AZZ", 0, SaveType::NONE, 0, 0}, // NONE}            Rocket Power - Zero Gravity Zone
+	{"B08", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     One Piece - Going Baseball
+	{"B23", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Sportsman's Pack - Cabela's Big Game Hunter + Rapala Pro Fishing
+	{"B24", 0, SaveType::Flash_1M_Macronix, 0, 0}, // FLASH_V102      Pokemon Mystery Dungeon - Red Rescue Team
+	{"B25", 0, SaveType::NONE, 0, 0}, // NONE}            Scooby-Doo! - Unmasked
+	{"B26", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     World Poker Tour
+	{"B27", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Top Spin 2
+	{"B2A", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     2 in 1 - Asterix & Obelix - PAF! Them All! + XXL
+	{"B2B", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     2 Games in 1 - The SpongeBob SquarePants Movie + Freeze Frame Frenzy
+	{"B2C", 0, SaveType::NONE, 0, 0}, // NONE}            Pac-Man World 2
+	{"B2D", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Donkey Kong Country 2
+	{"B2E", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - Dora the Explorer - Pirate Pig's Treasure + Super Star Adventures
+	{"B2F", 0, SaveType::NONE, 0, 0}, // NONE}            Family Feud
+	{"B2H", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Hugo 2 in 1 - Bukkazoom! + The Evil Mirror
+	{"B2K", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Kiss x Kiss - Seirei Gakuen
+	{"B2L", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Totally Spies 2 - Undercover
+	{"B2M", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Shonen Jump's Shaman King - Master of Spirits 2
+	{"B2N", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Arthur and the Invisibles
+	{"B2O", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Pro Mahjong - Tsuwamono GBA
+	{"B2P", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Twin Series 7 - Twin Puzzle - Kisekae Wanko Ex + Puzzle Rainbow Magic 2
+	{"B2Q", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Prince of Persia - The Sands of Time + Tomb Raider - The Prophecy
+	{"B2R", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V130      Super Robot Taisen - Original Generation 2
+	{"B2S", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Cinnamon - Yume no Daibouken
+	{"B2T", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Tony Hawk's Underground 2
+	{"B2V", 0, SaveType::NONE, 0, 0}, // NONE}            Snood 2 - On Vacation
+	{"B2W", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Chronicles of Narnia - The Lion, the Witch and the Wardrobe
+	{"B2Y", 0, SaveType::NONE, 0, 0}, // NONE}            Major League Baseball 2k7
+	{"B33", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Santa Clause 3 - The Escape Clause
+	{"B34", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Let's Ride! - Sunshine Stables
+	{"B35", 0, SaveType::NONE, 0, 0}, // NONE}            Strawberry Shortcake - Summertime Adventure
+	{"B36", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Dynasty Warriors Advance
+	{"B3A", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     The Lord of the Rings - The Third Age
+	{"B3B", 0, SaveType::NONE, 0, 0}, // NONE}            ATV Thunder - Ridge Riders
+	{"B3C", 0, SaveType::EEPROM_8k, 0, 0}, // EEPROM_V126     Summon Night Craft Sword Monogatari - Hajimari no Ishi
+	{"B3D", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Densetsu no Stafi 3
+	{"B3E", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      San Goku Shi Eiketsuden
+	{"B3F", 0, SaveType::NONE, 0, 0}, // NONE}            Polly Pocket!
+	{"B3G", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Sigma Star Saga
+	{"B3H", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Shrek the Third
+	{"B3I", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Mirakuru! Panzou - 7 Tsuno Hosh no Kaizoku
+	{"B3J", 0, SaveType::NONE, 0, 0}, // NONE}            Curious George
+	{"B3K", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Croket! 3 - Guranyuu Oukoku no Nazo
+	{"B3L", 0, SaveType::NONE, 0, 0}, // NONE}            Killer 3D Pool
+	{"B3M", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Mermaid Melody - Pichi Pichi Picchi Pichi Pichitto Live Start
+	{"B3N", 0, SaveType::NONE, 0, 0}, // NONE}            3 Games in One - Majesco's Sports Pack
+	{"B3O", 0, SaveType::NONE, 0, 0}, // NONE}            3 Game Pack - Mouse Trap + Simon + Operation
+	{"B3P", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Pukupuku Tennen Kairanban Youkoso Illusion Land
+	{"B3Q", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      San Goku Shi Koumeiden
+	{"B3R", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Driv3r
+	{"B3S", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Sonic Advance 3
+	{"B3T", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Tales of the World - Narikiri Dungeon 3
+	{"B3U", 0, SaveType::NONE, 0, 0}, // NONE}            3 Game Pack - The Game of Life + Yahtzee + Payday
+	{"B3X", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     X-Men - The Official Game
+	{"B3Y", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     The Legend of Spyro - A New Beginning
+	{"B3Z", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Global Star - Suduoku Feber
+	{"B42", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Kidou Senshi Gundam Seed Destiny
+	{"B43", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Cinnamon Fuwafuwa Daisakusen
+	{"B44", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     3 Games in 1 - Rugrats, SpongeBob, Tak
+	{"B46", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      The Sims 2
+	{"B4B", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Megaman Battle Network 4 - Blue Moon
+	{"B4D", 0, SaveType::NONE, 0, 0}, // NONE}            Sky Dancers - They Magically Fly!
+	{"B4G", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Tennis no Ouji-sama 2004 - Glorious Gold
+	{"B4I", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Shrek - Smash n' Crash Racing
+	{"B4K", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Shikakui Atama wo Marukusuru Advance - Kanji Keisan
+	{"B4L", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Sugar Sugar Une - Heart Gaippai! Moegi Gakuen
+	{"B4M", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Marvel - Ultimate Alliance
+	{"B4O", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      The Sims 2 - Pets
+	{"B4P", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     The Sims
+	{"B4R", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Shikakui Atama wo Marukusuru Advance - Kokugo Sansu Rika Shakai
+	{"B4S", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Tennis no Ouji-sama 2004 - Stylish Silver
+	{"B4T", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Strawberry Shortcake - Sweet Dreams
+	{"B4U", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Shrek - Super Slam
+	{"B4W", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       MegaMan Battle Network 4 - Red Sun
+	{"B4Z", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Megaman Zero 4
+	{"B52", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Crash & Spyro - Super Pack Volume 2
+	{"B53", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V126     Crash & Spyro Superpack - Ripto's Rampage + The Cortex Conspiracy
+	{"B54", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Crash & Spyro Superpack - The Huge Adventure + Season of Ice
+	{"B55", 0, SaveType::NONE, 0, 0}, // NONE}            Who Wants to Be a Millionaire - 2nd Edition
+	{"B5A", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Crash & Spyro - Super Pack Volume 1
+	{"B5N", 0, SaveType::NONE, 0, 0}, // NONE}            Namco Museum - 50th Anniversary
+	{"B62", 0, SaveType::NONE, 0, 0}, // NONE}            Millipede - Super Break Out - Lunar Lander
+	{"B63", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Big Mutha Truckers
+	{"B64", 0, SaveType::NONE, 0, 0}, // NONE}            Yars' Revenge - Pong - Asteroids
+	{"B65", 0, SaveType::NONE, 0, 0}, // NONE}            Connect Four - Perfection - Trouble
+	{"B66", 0, SaveType::NONE, 0, 0}, // NONE}            Risk - Battleship - Clue
+	{"B67", 0, SaveType::NONE, 0, 0}, // NONE}            Sorry! - Aggravation - Scrabble Junior
+	{"B68", 0, SaveType::NONE, 0, 0}, // NONE}            Marble Madness - Klax
+	{"B69", 0, SaveType::NONE, 0, 0}, // NONE}            Gauntlet - Rampart
+	{"B6A", 0, SaveType::NONE, 0, 0}, // NONE}            Spy Hunter - Super Sprint
+	{"B6B", 0, SaveType::NONE, 0, 0}, // NONE}            Paperboy - Rampage
+	{"B6E", 0, SaveType::NONE, 0, 0}, // NONE}            Board Games Classics
+	{"B6F", 0, SaveType::NONE, 0, 0}, // NONE}            Chicken Shoot
+	{"B6G", 0, SaveType::NONE, 0, 0}, // NONE}            Chicken Shoot 2
+	{"B6J", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Super Robot Taisen J
+	{"B6M", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Madden NFL 06
+	{"B6P", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Ms. Pac-Man - Maze Madness + Pac-Man World
+	{"B6W", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     FIFA World Cup 2006
+	{"B6Z", 0, SaveType::NONE, 0, 0}, // NONE}            Breakout + Centipede + Warlords
+	{"B72", 0, SaveType::NONE, 0, 0}, // NONE}            Hudson Collection Vol. 2 - Lode Runner Collection
+	{"B73", 0, SaveType::NONE, 0, 0}, // NONE}            Hudson Collection Vol. 3 - Action Collection
+	{"B74", 0, SaveType::NONE, 0, 0}, // NONE}            Hudson Best Collection Vol. 4 - Nazotoki Collection
+	{"B75", 0, SaveType::NONE, 0, 0}, // NONE}            Hudson Best Collection Vol. 5 - Shooting Collection
+	{"B76", 0, SaveType::NONE, 0, 0}, // NONE}            Hudson Best Collection Vol. 6 - Bouken Jima Collection
+	{"B7F", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     FIFA 07
+	{"B7I", 0, SaveType::NONE, 0, 0}, // NONE}            Hudson Best Collection 1
+	{"B7M", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Madden NFL 07
+	{"B82", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Dogz
+	{"B85", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Hamtaro - Ham-Ham Games
+	{"B86", 0, SaveType::NONE, 0, 0}, // NONE}            Hello Kitty - Happy Party Pals
+	{"B8A", 0, SaveType::EEPROM_8k, 0, 0}, // EEPROM_V122     Crash Superpack - N-Tranced + Nitro Kart
+	{"B8C", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Kingdom Hearts - Chain of Memories
+	{"B8D", 0, SaveType::NONE, 0, 0}, // NONE}            Around the World in 80 Days
+	{"B8F", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Herbie Fully Loaded
+	{"B8K", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Kirby & the Amazing Mirror
+	{"B8M", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Mario Party Advance
+	{"B8P", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Power Pro Kun Pocket 1&2
+	{"B8Q", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Pirates of the Caribbean - Dead Man's Chest
+	{"B8S", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Spyro Superpack - Season of Ice + Season of Flame
+	{"B94", 0, SaveType::EEPROM_8k, 0, 0}, // EEPROM_V124     2 in 1 - Pferd & Pony - Mein Pferdehof + Lass Uns Reiten 2
+	{"B9A", 0, SaveType::NONE, 0, 0}, // NONE}            Kunio kun Nekketsu Collection 1
+	{"B9B", 0, SaveType::NONE, 0, 0}, // NONE}            Kunio Kun Nekketsu Collection 2
+	{"B9C", 0, SaveType::NONE, 0, 0}, // NONE}            Kuniokun Nekketsu Collection 3
+	{"B9S", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Trick Star
+	{"B9T", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Shark Tale
+	{"BAA", 0, SaveType::NONE, 0, 0}, // NONE}            Operation Armored Liberty
+	{"BAB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Aleck Bordon Adventure - Tower & Shaft Advance
+	{"BAC", 0, SaveType::NONE, 0, 0}, // NONE}            Action Man - Robot Atak
+	{"BAD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Aladdin
+	{"BAE", 0, SaveType::NONE, 0, 0}, // NONE}            Ace Combat Advance
+	{"BAG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Advance Guardian Heroes
+	{"BAH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Alien Hominid
+	{"BAJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Banjo Pilot
+	{"BAK", 0, SaveType::NONE, 0, 0}, // NONE}            The Koala Brothers - Outback Adventures
+	{"BAL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     All Grown Up - Express Yourself
+	{"BAM", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Ashita no Joe - Makka ni Moeagare!
+	{"BAN", 0, SaveType::NONE, 0, 0}, // NONE}            Van Helsing
+	{"BAP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     American Dragon - Jake Long
+	{"BAQ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Premier Action Soccer
+	{"BAR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     2 Games in 1 - Moto GP - GT 3 Advance
+	{"BAS", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Gakuen Alice - DokiDoki Fushigi Taiken
+	{"BAT", 0, SaveType::NONE, 0, 0}, // NONE}            Batman Rise of Sin Tzu
+	{"BAU", 0, SaveType::NONE, 0, 0}, // NONE}            Barbie - The Princess and the Pauper
+	{"BAV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Activision Anthology
+	{"BAW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Alex Rider - Stormbreaker
+	{"BAX", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Animal Yokochou - Doki Doki Shinkyuu Shiken! no Kan
+	{"BAY", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Animal Yokochou - Doki Doki Kyushutsu Daisakusen No Maki
+	{"BAZ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Akachan Doubutsu Sono
+	{"BB2", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Beyblade G-Revolution
+	{"BB3", 0, SaveType::NONE, 0, 0}, // NONE}            Barbie in the 12 Dancing Princesses
+	{"BB4", 0, SaveType::NONE, 0, 0}, // NONE}            2 Game Pack! - Matchbox Missions
+	{"BB5", 0, SaveType::NONE, 0, 0}, // NONE}            Arctic Tale
+	{"BB7", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Backyard Sports - Basketball 2007
+	{"BB8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Word Safari - The Friendship Totems
+	{"BB9", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Boboboubo Boubobo - 9 Kiwame Senshi Gyagu Yuugou
+	{"BBA", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V126     Shamu's Deep Sea Adventures
+	{"BBC", 0, SaveType::NONE, 0, 0}, // NONE}            Back to Stone
+	{"BBD", 0, SaveType::NONE, 0, 0}, // NONE}            BattleBots - Design & Destroy
+	{"BBE", 0, SaveType::NONE, 0, 0}, // NONE}            Barbie Superpack - Secret Agent + Groovy Games
+	{"BBF", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Battle x Battle - Kyoudai Ou Densetsu
+	{"BBG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Batman Begins
+	{"BBH", 0, SaveType::NONE, 0, 0}, // NONE}            Blades of Thunder
+	{"BBI", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Barbie Diaries - High School Mystery
+	{"BBJ", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - SpongeBob SquarePants + Jimmy Neutron
+	{"BBK", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       DK - King of Swing
+	{"BBL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Teen Titans
+	{"BBM", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Battle B-Daman - Fire Spirits
+	{"BBN", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Barbie as the Island Princess
+	{"BBO", 0, SaveType::NONE, 0, 0}, // NONE}            The Berenstain Bears - And the Spooky Old Tree
+	{"BBQ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Pawa Poke Dash
+	{"BBR", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Brother Bear
+	{"BBS", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Boukyaku no Senritsu
+	{"BBU", 0, SaveType::NONE, 0, 0}, // NONE}            Bratz - The Movie
+	{"BBV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Babar - To the Rescue
+	{"BBW", 0, SaveType::NONE, 0, 0}, // NONE}            Avatar - The Last Airbender - The Burning Earth
+	{"BBX", 0, SaveType::NONE, 0, 0}, // NONE}            Bibi Blocksberg - Der Magische Hexenkreis
+	{"BBY", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Barnyard
+	{"BBZ", 0, SaveType::NONE, 0, 0}, // NONE}            Bratz - Babyz
+	{"BC2", 0, SaveType::EEPROM_8k, 0, 0}, // EEPROM_V126     Crayon Shin chan - Densetsu wo Yobu Omake no Miyako Shockgaan
+	{"BC3", 0, SaveType::NONE, 0, 0}, // NONE}            CT Special Forces 3 - Bioterror
+	{"BC4", 0, SaveType::NONE, 0, 0}, // NONE}            3 Game Pack - Candy Land + Chutes and Ladders + Memory
+	{"BC5", 0, SaveType::NONE, 0, 0}, // NONE}            Cocoto - Kart Racer
+	{"BC6", 0, SaveType::NONE, 0, 0}, // NONE}            Capcom Classics - Mini Mix
+	{"BC7", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Backyard Sports - Baseball 2007
+	{"BC8", 0, SaveType::NONE, 0, 0}, // NONE}            Cocoto Platform Jumper
+	{"BC9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Spider-Man - Battle For New York
+	{"BCA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Cars
+	{"BCB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Crushed Baseball
+	{"BCC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Nicktoons - Freeze Frame Frenzy
+	{"BCD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Cinderella - Magical Dreams
+	{"BCF", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Charlie and the Chocolate Factory
+	{"BCG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Cabbage Patch Kids - The Patch Puppy Rescue
+	{"BCH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Chicken Little
+	{"BCJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Charlotte's Web
+	{"BCK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Star Wars Trilogy - Apprentice of the Force
+	{"BCL", 0, SaveType::NONE, 0, 0}, // NONE}            Super Collapse! II
+	{"BCM", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     CIMA - The Enemy
+	{"BCN", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Crash Nitro Kart
+	{"BCP", 0, SaveType::NONE, 0, 0}, // NONE}            Cars Mater-National Championship
+	{"BCQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Cheetah Girls
+	{"BCR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Crazy Frog Racer
+	{"BCS", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     2 in 1 - V-Rally 3 - Stuntman
+	{"BCT", 0, SaveType::NONE, 0, 0}, // NONE}            The Cat in the Hat by Dr. Seuss
+	{"BCU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Ochaken no Yumebouken
+	{"BCV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     2 Games in 1 - Scooby-Doo and the Cyber Chase + Mystery Mayhem
+	{"BCW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Catwoman
+	{"BCX", 0, SaveType::NONE, 0, 0}, // NONE}            Kid's Cards
+	{"BCY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Backyard Baseball 2006
+	{"BCZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Street Racing Syndicate
+	{"BD2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Duel Masters 2
+	{"BD3", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Dragon Quest Characters - Torneko no Daibouken 3 Advance
+	{"BD4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Crash Bandicoot Purple - Ripto's Rampage
+	{"BD5", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Duel Masters 2 - Kirifuda Shoubu Version
+	{"BD6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Duel Masters - Kaijudo Showdown
+	{"BD7", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Proud Family
+	{"BD8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Disney's Party
+	{"BD9", 0, SaveType::NONE, 0, 0}, // NONE}            Dragon Tales - Dragon Adventures
+	{"BDA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Donchan Puzzle Hanabi de Dohn Advance
+	{"BDB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Dragon Ball Z - Taiketsu
+	{"BDC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Doubutsujima no Chobi Gurumi 2 - Tamachan Monogatari
+	{"BDD", 0, SaveType::NONE, 0, 0}, // NONE}            Double Dragon Advance
+	{"BDE", 0, SaveType::NONE, 0, 0}, // NONE}            Dead to Rights
+	{"BDF", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - SpongeBob SquarePants - Supersponge + Revenge of the Flying Dutchman
+	{"BDG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Digimon Racing
+	{"BDH", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Shin Megami Tensei Devil Children - Honoo no Sho
+	{"BDI", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Koinu to Issho - Aijou Monogatari
+	{"BDJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Digimon Racing
+	{"BDK", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Digi Communication 2 in 1 Datou! Black Gemagema Dan
+	{"BDL", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Shin Megami Tensei - Devil Children Messiah Riser
+	{"BDM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Super Real Mahjong Dousoukai
+	{"BDN", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Dan Doh!! - Tobase Shouri no Smile Shot!!
+	{"BDO", 0, SaveType::NONE, 0, 0}, // NONE}            Dora the Explorer - Super Star Adventures!
+	{"BDP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Super Duper Sumos
+	{"BDQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Donkey Kong Country 3
+	{"BDR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Ochaken no Heya
+	{"BDS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Digimon - Battle Spirit 2
+	{"BDT", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     River City Ransom EX
+	{"BDU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Duel Masters - Shadow of the Code
+	{"BDV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Dragon Ball - Advanced Adventure
+	{"BDX", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Battle B-Daman
+	{"BDY", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Shin Megami Tensei Devil Children - Koori no Sho
+	{"BDZ", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - Finding Nemo + Monsters, Inc.
+	{"BE2", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Kisekae Angel Series 2 - Charisma Tenin Ikusei Game
+	{"BE3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Star Wars Episode III - Revenge of the Sith
+	{"BE4", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Eyeshield 21 - Devilbats Devildays
+	{"BE5", 0, SaveType::NONE, 0, 0}, // NONE}            Barbie and the Magic of Pegasus
+	{"BE8", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Fire Emblem - The Sacred Stones
+	{"BEA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Care Bears - The Care Quest
+	{"BEB", 0, SaveType::NONE, 0, 0}, // NONE}            Elf Bowling 1 & 2
+	{"BEC", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Angel Collection 2 - Pichimo ni Narou
+	{"BED", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Ed, Edd n Eddy - The Mis-Edventures
+	{"BEE", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Maya The Bee - Sweet Gold
+	{"BEF", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Let's Ride - Friends Forever
+	{"BEI", 0, SaveType::NONE, 0, 0}, // NONE}            Little Einsteins
+	{"BEJ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Erementar Gerad
+	{"BEL", 0, SaveType::NONE, 0, 0}, // NONE}            Elf - The Movie
+	{"BEM", 0, SaveType::NONE, 0, 0}, // NONE}            M&M's Break' Em
+	{"BEN", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Eragon
+	{"BER", 0, SaveType::NONE, 0, 0}, // NONE}            Dora the Explorer - Super Spies
+	{"BES", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Extreme Skate Adventure
+	{"BET", 0, SaveType::NONE, 0, 0}, // NONE}            Atomic Betty
+	{"BEV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Ever Girl
+	{"BEX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     TMNT
+	{"BEY", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Beyblade VForce - Ultimate Blader Jam
+	{"BF2", 0, SaveType::NONE, 0, 0}, // NONE}            The Fairly Odd Parents! - Shadow Showdown
+	{"BF3", 0, SaveType::NONE, 0, 0}, // NONE}            Ford Racing 3
+	{"BF4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Fantastic 4
+	{"BF5", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     FIFA 2005
+	{"BF6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     FIFA 06
+	{"BF7", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Backyard Sports - Football 2007
+	{"BF8", 0, SaveType::NONE, 0, 0}, // NONE}            Super Hornet FA 18F
+	{"BFB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       2 Disney Games - Disney Sports Skateboarding + Football
+	{"BFC", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Fantasic Children
+	{"BFD", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Fruit Mura no Doubutsu Tachi
+	{"BFE", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Dogz - Fashion
+	{"BFF", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Final Fantasy I & II - Dawn of Souls
+	{"BFG", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Harvest Moon - More Friends of Mineral Town
+	{"BFI", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     FIFA 2004
+	{"BFJ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Frogger's Journey - The Forgotten Relic
+	{"BFK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Franklin the Turtle
+	{"BFL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Franklin's Great Adventures
+	{"BFM", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Futari wa Precure Max Heart Maji! Maji! Fight de IN Janai
+	{"BFN", 0, SaveType::NONE, 0, 0}, // NONE}            Finding Nemo
+	{"BFO", 0, SaveType::NONE, 0, 0}, // NONE}            The Fairly Odd Parents! - Clash with the Anti-World
+	{"BFP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Futari ha Precure Arienaai Yume no Kuni ha Daimeikyuu
+	{"BFQ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Mazes of Fate
+	{"BFR", 0, SaveType::EEPROM_8k, 0, 0}, // EEPROM_V126     My Animal Centre in Africa
+	{"BFS", 0, SaveType::NONE, 0, 0}, // NONE}            Freekstyle
+	{"BFT", 0, SaveType::Flash_1M_Macronix, 0, 0}, // FLASH_V102      F-Zero - Climax
+	{"BFU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Fear Factor Unleashed
+	{"BFV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Twin Series 1 - Fashion Designer Monogatari + Kawaii Pet Game Gallery 2
+	{"BFW", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - Finding Nemo + Finding Nemo - The Continuing Adventures
+	{"BFX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Phil of the Future
+	{"BFY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Foster's Home for Imaginary Friends
+	{"BFZ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       F-Zero - GP Legends
+	{"BG2", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Kessakusen Ganbare Goemon 1 and 2
+	{"BG3", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Dragon Ball Z - Buu's Fury
+	{"BG4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     SD Gundam Force
+	{"BG5", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Cabela's Big Game Hunter - 2005 Adventures
+	{"BG6", 0, SaveType::NONE, 0, 0}, // NONE}            Super Army War
+	{"BG7", 0, SaveType::NONE, 0, 0}, // NONE}            Games Explosion!
+	{"BG8", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Ganbare! Dodge Fighters
+	{"BG9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Garfield and His Nine Lives
+	{"BGA", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     SD Gundam G Generation
+	{"BGB", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Get! - Boku no Mushi Tsukamaete
+	{"BGC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Advance Guardian Heroes
+	{"BGD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Baldurs Gate - Dark Alliance
+	{"BGE", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     SD Gundam Force
+	{"BGF", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       GetBackers Dakkanya - Jagan Fuuin!
+	{"BGG", 0, SaveType::NONE, 0, 0}, // NONE}            Golden Nugget Casino
+	{"BGH", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Gakkou no Kaidan - Hyakuyobako no Fuuin
+	{"BGI", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Get Ride AMDriver - Senkou no Hero Tanjou
+	{"BGJ", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Genseishin the Justirisers - Souchaku Chikyuu no
+	{"BGK", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Gegege no Kitarou - Kikiippatsu! Youkai Rettou
+	{"BGM", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Gensou Maden Saiyuuki - Hangyaku no Toushin-taishi
+	{"BGN", 0, SaveType::NONE, 0, 0}, // NONE}            Mobile Suit Gundam Seed - Battle Assault
+	{"BGO", 0, SaveType::NONE, 0, 0}, // NONE}            Garfield - The Search for Pooky
+	{"BGP", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Get Ride! AMDrive Shutsugeki Battle Party
+	{"BGQ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Greg Hastings' Tournament Paintball Max'd
+	{"BGS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Gakuen Senki Muryou
+	{"BGT", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Grand Theft Auto Advance
+	{"BGV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Gumby vs. The Astrobots
+	{"BGW", 0, SaveType::Flash_1M_Macronix, 0, 0}, // FLASH_V102      Gameboy Wars Advance 1+2
+	{"BGX", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Gunstar Super Heroes
+	{"BGY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Konjiki no Gashbell!! Unare Yuujou no Dengeki
+	{"BGZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Madagascar
+	{"BH2", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Hagane no Renkinjutsushi - Omoide no Sonata
+	{"BH3", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V126     Happy Feet
+	{"BH4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Fantastic 4 - Flame On
+	{"BH5", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Over the Hedge
+	{"BH6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Haro no Puyo Puyo
+	{"BH7", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Over the Hedge - Hammy Goes Nuts
+	{"BH8", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V126     Harry Potter and the Goblet of Fire
+	{"BH9", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Tony Hawk's American Sk8land
+	{"BHA", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Hanabi Hyakkei Advance
+	{"BHB", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Best Friends - Dogs & Cats
+	{"BHC", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Hamster Monogatari Collection
+	{"BHD", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Hello Idol Debut
+	{"BHE", 0, SaveType::NONE, 0, 0}, // NONE}            Hot Wheels - Stunt Track Challenge
+	{"BHF", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Twin Series 4 - Ham Ham Monster EX + Fantasy Puzzle Hamster Monogatari
+	{"BHG", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Gunstar Super Heroes
+	{"BHH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Hi Hi Puffy - AmiYumi Kaznapped
+	{"BHJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Heidi
+	{"BHL", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Shaman King - Legacy of the Spirits - Soaring Hawk
+	{"BHM", 0, SaveType::NONE, 0, 0}, // NONE}            Home on the Range
+	{"BHN", 0, SaveType::NONE, 0, 0}, // NONE}            Harlem Globetrotters - World Tour
+	{"BHO", 0, SaveType::NONE, 0, 0}, // NONE}            Hardcore Pool
+	{"BHP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Harry Potter - Quidditch World Cup
+	{"BHQ", 0, SaveType::NONE, 0, 0}, // NONE}            Agent Hugo - Roborumble
+	{"BHR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Hagane no Renkinjutsushi - Meisou no Rondo
+	{"BHS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Hamster Monogatari 3EX 4 Special
+	{"BHT", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Harry Potter and the Prisoner of Azkaban
+	{"BHU", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Horsez
+	{"BHV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Scurge - Hive
+	{"BHW", 0, SaveType::NONE, 0, 0}, // NONE}            Hot Wheels - World Race
+	{"BHX", 0, SaveType::NONE, 0, 0}, // NONE}            Hot Wheels All Out
+	{"BHY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Minna no Soft Series - Hyokkori Hyoutan-jima - Don Gabacho Daikatsuyaku no Maki
+	{"BHZ", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - Hot Wheels - World Race + Velocity X
+	{"BI2", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Koinu to Issho! 2
+	{"BI3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Spider-Man 3
+	{"BI4", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       4 Games on One Game Pak - GT Advance - GT Advance 2 - GT Advance 3 - Moto GP
+	{"BI6", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       4 Games on One Game Pak (Nickelodeon Movies)
+	{"BI7", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       4 Games on One Game Pak - Nickelodeon
+	{"BIA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Ice Age 2 - The Meltdown
+	{"BIB", 0, SaveType::NONE, 0, 0}, // NONE}            Bible Game, The
+	{"BIC", 0, SaveType::NONE, 0, 0}, // NONE}            The Incredibles
+	{"BID", 0, SaveType::NONE, 0, 0}, // NONE}            American Idol
+	{"BIE", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Grim - Adventures of Billy and Mandy
+	{"BIH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Bionicle Heroes
+	{"BII", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Polarium Advance
+	{"BIJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Sonic The Hedgehog - Genesis
+	{"BIK", 0, SaveType::EEPROM_8k, 0, 0}, // EEPROM_V124     Ochainuken Kururin
+	{"BIL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Bionicle - Maze of Shadows
+	{"BIM", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Dogz 2
+	{"BIN", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - Finding Nemo + The Incredibles
+	{"BIO", 0, SaveType::NONE, 0, 0}, // NONE}            Bionicle
+	{"BIP", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     One Piece - Dragon Dream
+	{"BIQ", 0, SaveType::NONE, 0, 0}, // NONE}            The Incredibles - Rise of the Underminer
+	{"BIR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Iron Kid
+	{"BIS", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Koinu-Chan no Hajimete no Osanpo - Koinu no Kokoro Ikusei Game
+	{"BIT", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Onmyou Taisenki Zeroshik
+	{"BIV", 0, SaveType::NONE, 0, 0}, // NONE}            Ignition Collection - Volume 1 (3 Games in 1)
+	{"BIX", 0, SaveType::Flash_1M_Macronix, 0, 0}, // FLASH_V102      Calciobit
+	{"BIY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Math Patrol - The Kleptoid Threat
+	{"BJ2", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     High School Musical - Livin' the Dream
+	{"BJ3", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Zettai Zetsumei - Dangerous Jiisan 3 Hateshinaki Mamonogatari
+	{"BJA", 0, SaveType::NONE, 0, 0}, // NONE}            GT Racers
+	{"BJB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     007 - Everything or Nothing
+	{"BJC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Moero! Jaleco Collection
+	{"BJD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Dragon's Rock
+	{"BJH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Justice League Heroes - The Flash
+	{"BJK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Juka and the Monophonic Menace
+	{"BJL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Justice League Chronicles
+	{"BJN", 0, SaveType::NONE, 0, 0}, // NONE}            The Adventures of Jimmy Neutron - Boy Genius - Jet Fusion
+	{"BJP", 0, SaveType::EEPROM_8k, 0, 0}, // EEPROM_V126     Harry Potter Collection
+	{"BJT", 0, SaveType::NONE, 0, 0}, // NONE}            Tom and Jerry Tales
+	{"BJU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Tak and the Power of Juju
+	{"BJW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Tak - The Great Juju Challenge
+	{"BJX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Harry Potter and the Order of the Phoenix
+	{"BJY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Jimmy Neutron Boy Genius - Attack of the Twonkies
+	{"BK2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Croket! 2 - Yami no Bank to Banqueen
+	{"BK3", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Card Captor Sakura - Sakura Card de Mini Game
+	{"BK4", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Croket! 4 - Bank no Mori no Mamorigami
+	{"BK5", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Korokke Great Toki no Boukensha
+	{"BK6", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Kouchu Ouja - Mushi King
+	{"BK7", 0, SaveType::NONE, 0, 0}, // NONE}            Kong - King of Atlantis
+	{"BK8", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Kappa no Kai-Kata - Katan Daibouken
+	{"BKA", 0, SaveType::Flash_1M_Macronix, GAME_RTC, 0}, // FLASH_V102      Sennen Kazoku
+	{"BKB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Konjiki no Gashbell!! Makai no Bookmark
+	{"BKC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Crayon Shin-Chan - Arashi no Yobu Cinema-Land no Daibouken!
+	{"BKD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Crash Bandicoot Advance - Wakuwaku Tomodachi Daisakusen
+	{"BKE", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Konjiki no Gashbell - The Card Battle for GBA
+	{"BKF", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Bee Game
+	{"BKG", 0, SaveType::NONE, 0, 0}, // NONE}            Kawaii Pet Game Gallery
+	{"BKH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Kill Switch
+	{"BKI", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Nakayoshi Pet Advance Series 4 - Kawaii Koinu Mini - Wankoto Asobou!! Kogata-ken
+	{"BKJ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Keroro Gunsou Taiketsu Gekisou
+	{"BKK", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Minna no Shiiku Series - Boku no Kabuto-Kuwagata
+	{"BKM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Kim Possible 2 - Drakken's Demise
+	{"BKN", 0, SaveType::NONE, 0, 0}, // NONE}            LEGO Knights Kingdom
+	{"BKO", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Kaiketsu Zorori to Mahou no Yuuenchi
+	{"BKP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Kawaii Pet Game Gallery 2
+	{"BKQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Kong - The 8th Wonder of the World
+	{"BKR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Nonono Puzzle Chailien
+	{"BKS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Card Captor Sakura - Sakura to Card to Otomodachi
+	{"BKT", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Steel Empire
+	{"BKU", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Shingata Medarot - Kuwagata Version
+	{"BKV", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Shingata Medarot - Kabuto Version
+	{"BKW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Bookworm
+	{"BKZ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Banjo-Kazooie - Grunty's Revenge
+	{"BL2", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Lizzie McGuire 2 - Lizzie Diaries
+	{"BL3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Lizzie McGuire 3 - Homecoming Havoc
+	{"BL4", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Lizzie McGuire 2 - Lizzie Diaries - Special Edition
+	{"BL5", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - Bionicle + Knights' Kingdom
+	{"BL6", 0, SaveType::NONE, 0, 0}, // NONE}            My Little Pony - Crystal Princess - The Runaway Rainbow
+	{"BL7", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     LEGO Star Wars II - The Original Trilogy
+	{"BL8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V126     Tomb Raider - Legend
+	{"BL9", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Let's Ride! Dreamer
+	{"BLA", 0, SaveType::NONE, 0, 0}, // NONE}            Scrabble Blast!
+	{"BLB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     2 Games in 1 - Brother Bear + The Lion King
+	{"BLC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Camp Lazlo - Leaky Lake Games
+	{"BLD", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     2 Games in 1 - Lizzie McGuire - Disney Princess
+	{"BLE", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Bleach Advance
+	{"BLF", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     2 in 1 - Dragon Ball Z 1 and 2
+	{"BLH", 0, SaveType::NONE, 0, 0}, // NONE}            Flushed Away
+	{"BLI", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Little Patissier Cake no Oshiro
+	{"BLJ", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Legendz - Yomigaeru Shiren no Shima
+	{"BLK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The Lion King 1.5
+	{"BLM", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V120     Lizzie McGuire
+	{"BLN", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Looney Tunes Double Pack - Dizzy Driving + Acme Antics
+	{"BLO", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Land Before Time - Into the Mysterious Beyond
+	{"BLP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     2 Games in 1 - Disney Princess + The Lion King
+	{"BLQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     2 Disney Games - Lilo & Stitch 2 + Peter Pan
+	{"BLR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     The Lord of the Rings - The Return of the King
+	{"BLS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Lilo & Stitch 2 - Hamsterveil Havoc
+	{"BLT", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Looney Tunes - Back in Action
+	{"BLV", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Legendz - Sign of Necrom
+	{"BLW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     LEGO Star Wars - The Video Game
+	{"BLX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Asterix & Obelix - XXL
+	{"BLY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Lemony Snicket's A Series of Unfortunate Events
+	{"BM2", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Momotarou Densetsu G Gold Deck wo Tsukure!
+	{"BM3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Mickey to Donald no Magical Quest 3
+	{"BM4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Mickey to Pocket Resort
+	{"BM5", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Mario vs. Donkey Kong
+	{"BM7", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Madagascar - Operation Penguin
+	{"BM8", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Mermaid Melody - Pichi Pichi Pitch Pichi Pichi Party
+	{"BM9", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Marheaven - Knockin' on Heaven's Door
+	{"BMA", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Mermaid Melody - Pichi Pichi Pitch
+	{"BMB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Mighty Beanz - Pocket Puzzles
+	{"BMC", 0, SaveType::NONE, 0, 0}, // NONE}            Monster Trucks
+	{"BMD", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Madden NFL 2004
+	{"BME", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Max Payne
+	{"BMF", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Madden NFL 2005
+	{"BMG", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Mario Golf - Advance Tour
+	{"BMH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Medal of Honor - Infiltrator
+	{"BMI", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Wagamama - Fairy Milmo de Pon! DokiDoki Memorial
+	{"BMJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Minna no Mahjong
+	{"BMK", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Mezase Koushien
+	{"BML", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Mucha Lucha - Mascaritas of the Lost Code
+	{"BMM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Scooby-Doo! - Mystery Mayhem
+	{"BMO", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Minna no Ouji-sama
+	{"BMP", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Wagamama Fairy Mirumo de Pon! - Taisen Mahoudama
+	{"BMQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Magical Quest 3 Starring Mickey and Donald
+	{"BMR", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Matantei Loki Ragnarok - Gensou no Labyrinth
+	{"BMT", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Monster Truck Madness
+	{"BMU", 0, SaveType::NONE, 0, 0}, // NONE}            Scooby-Doo 2 - Monsters Unleashed
+	{"BMV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Mario Pinball Land
+	{"BMW", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Twin Series 5 - Wan Wan Meitantei EX + Mahou no Kuni no Keaki-Okusan Monogatari
+	{"BMX", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Metroid - Zero Mission
+	{"BMY", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Wagamama Fairy Mirumo de Pon! - 8 Nin no Toki no Yousei
+	{"BMZ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Zooo
+	{"BN2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Naruto Ninja Council 2
+	{"BN4", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Kawa no Nushitsuri 3 & 4
+	{"BN7", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Need for Speed Carbon - Own the City
+	{"BN9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Little Mermaid - Magic in Two Kingdoms
+	{"BNB", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Petz Vet
+	{"BNC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Tim Burton's The Nightmare Before Christmas - The Pumpkin King
+	{"BND", 0, SaveType::NONE, 0, 0}, // NONE}            Codename Kids Next Door - Operation S.O.D.A.
+	{"BNE", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - The Incredibles + Finding Nemo - The Continuing Adventure
+	{"BNF", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Need for Speed - Underground 2
+	{"BNG", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Mahou Sensei Negima
+	{"BNJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Jajamaru Jr. Denshouki - Jaleco Memorial
+	{"BNK", 0, SaveType::NONE, 0, 0}, // NONE}            Noddy - A day in Toyland
+	{"BNL", 0, SaveType::NONE, 0, 0}, // NONE}            Ratatouille
+	{"BNM", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Mahou Sensei Negima! Private Lesson 2
+	{"BNP", 0, SaveType::NONE, 0, 0}, // NONE}            Princess Natasha - Student Secret Agent
+	{"BNR", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Naruto RPG - Uketsugareshi Hi no Ishi
+	{"BNS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Need for Speed - Underground
+	{"BNT", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Teenage Mutant Ninja Turtles
+	{"BNU", 0, SaveType::NONE, 0, 0}, // NONE}            Nicktoons Unite!
+	{"BNV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Nicktoons - Battle for Volcano Island
+	{"BNW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Need for Speed - Most Wanted
+	{"BNY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Nyan Nyan Nyanko no Nyan Collection
+	{"BO2", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Ochainu no Bouken Jima
+	{"BO3", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Oshare Princess 3
+	{"BO5", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Oshare Princess 5
+	{"BO8", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     One Piece - Going Baseball Haejeok Yaku
+	{"BOA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Open Season
+	{"BOB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Boboboubo Boubobo - Maji De!! Shinken Battle
+	{"BOC", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      The Urbz - Sims in the City
+	{"BOD", 0, SaveType::NONE, 0, 0}, // NONE}            Oddworld - Munch's Oddysee
+	{"BOF", 0, SaveType::NONE, 0, 0}, // NONE}            Ottifanten Pinball
+	{"BOJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Ojarumaru - Gekkouchou Sanpo de Ojaru
+	{"BOM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Bomberman Jetters - Game Collection
+	{"BON", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     One Piece
+	{"BOP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Twin Series 2 - Oshare Princess 4 + Renai Uranai Daisakusen
+	{"BOS", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Boboboubo Boubobo Bakutou Hajike Taisen
+	{"BOV", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Bouken-Ou Beet - Busters Road
+	{"BOX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     FightBox
+	{"BOZ", 0, SaveType::NONE, 0, 0}, // NONE}            Ozzy & Drix
+	{"BP3", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Pia Carrot he Youkoso!! 3.3
+	{"BP4", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Premier Manager 2004 - 2005
+	{"BP5", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Premier Manager 2005 - 2006
+	{"BP6", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V112       Power Pro Kun Pocket 6
+	{"BP7", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Power Pro Kun Pocket 7
+	{"BP8", 0, SaveType::NONE, 0, 0}, // NONE}            Pac-Man Pinball Advance
+	{"BP9", 0, SaveType::NONE, 0, 0}, // NONE}            World Championship Poker
+	{"BPA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Pac-Man World
+	{"BPB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Pyuu to Fuku! Jaguar - Byo to Deru! Megane Kun
+	{"BPC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Ms. Pac-Man - Maze Madness
+	{"BPD", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Bouken Yuuki PlaStar World - Densetsu no PlaStar Gate EX
+	{"BPE", 0, SaveType::Flash_1M_Macronix_RTC, GAME_RTC, 0}, // FLASH_V103      Pokemon - Emerald Version
+	{"BPF", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Puyo Pop Fever
+	{"BPG", 0, SaveType::Flash_1M_Macronix_RTC, GAME_RTC, 0}, // FLASH_V103      Pokemon - Leaf Green Version
+	{"BPH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V120     Pitfall - The Lost Expedition
+	{"BPI", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     It's Mr Pants
+	{"BPJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Pocket Professor - Kwik Notes Vol. 1
+	{"BPK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Payback
+	{"BPL", 0, SaveType::NONE, 0, 0}, // NONE}            Archer Maclean's 3D Pool
+	{"BPM", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Premier Manager 2003-04
+	{"BPN", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Pika Pika Nurse Monogatari - Nurse Ikusei Game
+	{"BPO", 0, SaveType::NONE, 0, 0}, // NONE}            Power Rangers - Dino Thunder
+	{"BPP", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Pokemon Pinball - Ruby & Sapphire
+	{"BPQ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     PukuPuku Tennen Kairanban - Koi no Cupid Daisakusen
+	{"BPR", 0, SaveType::Flash_1M_Macronix_RTC, GAME_RTC, 0}, // FLASH_V103      Pokemon - Fire Red Version
+	{"BPS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Cinnamoroll Kokoniiruyo
+	{"BPT", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Peter Pan - The Motion Picture Event
+	{"BPU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     2 Games in 1 - Scooby-Doo + Scooby-Doo 2
+	{"BPV", 0, SaveType::EEPROM_8k, 0, 0}, // EEPROM_V124     Pferd & Pony - Mein Pferdehof
+	{"BPW", 0, SaveType::NONE, 0, 0}, // NONE}            Power Rangers - Ninja Storm
+	{"BPX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Polar Express
+	{"BPY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Prince of Persia - The Sands of Time
+	{"BPZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Pazunin - Uminin No Puzzle de Nimu
+	{"BQ3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Rayman - Raving Rabbids
+	{"BQ4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     SpongeBob SquarePants - Creature from the Krusty Krab
+	{"BQ7", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Monster House
+	{"BQ9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Pixeline i Pixieland
+	{"BQA", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Meitantei Conan Akatsuki no Monument
+	{"BQB", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Konchu Monster Battle Master
+	{"BQC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Crash of the Titans
+	{"BQD", 0, SaveType::NONE, 0, 0}, // NONE}            Quad Desert Fury
+	{"BQJ", 0, SaveType::NONE, 0, 0}, // NONE}            2 Game Pack - Hot Wheels Stunt Track + World Race
+	{"BQK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Konchuu no Mori no Daibouken
+	{"BQL", 0, SaveType::NONE, 0, 0}, // NONE}            March of the Penguins
+	{"BQM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Twin Series 3 - Konchuu Monster + Suchai Labyrinth
+	{"BQN", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Disney Princess - Royal Adventure
+	{"BQP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Kim Possible 3 - Team Possible
+	{"BQQ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     SpongeBob SquarePants - Lights, Camera, Pants!
+	{"BQS", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Konchu Monster Battle Stadium
+	{"BQT", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     My Pet Hotel
+	{"BQV", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Meine Tierarztpraxis
+	{"BQW", 0, SaveType::NONE, 0, 0}, // NONE}            Strawberry Shortcake - Summertime Adventure - Special Edition
+	{"BQX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Superman Returns - Fortress of Solitude
+	{"BQY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Danny Phantom - Urban Jungle
+	{"BQZ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Avatar - The Last Airbender
+	{"BR2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Mr. Driller 2
+	{"BR3", 0, SaveType::NONE, 0, 0}, // NONE}            R-Type III
+	{"BR4", 0, SaveType::Flash_512k_Panasonic_RTC, GAME_RTC, 0}, // FLASH_V131      Rockman EXE 4.5 - Real Operation
+	{"BR5", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       MegaMan Battle Network 6 - Cybeast Gregar
+	{"BR6", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       MegaMan Battle Network 6 - Cybeast Falzar
+	{"BR7", 0, SaveType::NONE, 0, 0}, // NONE}            Rock 'Em Sock 'Em Robots
+	{"BR8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Ghost Rider
+	{"BR9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Relaxuma na Mainichi
+	{"BRA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Racing Gears Advance
+	{"BRB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Megaman Battle Network 5 - Team Protoman
+	{"BRD", 0, SaveType::NONE, 0, 0}, // NONE}            Power Rangers - S.P.D.
+	{"BRE", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Riviera - The Promised Land
+	{"BRF", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Rapala Pro Fishing
+	{"BRG", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Yu-Yu-Hakusho - Tournament Tactics
+	{"BRH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Meet the Robinsons
+	{"BRI", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V110       Rhythm Tengoku
+	{"BRK", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Megaman Battle Network 5 - Team Colonel
+	{"BRL", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Rebelstar - Tactical Command
+	{"BRM", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Rave Master - Special Attack Force
+	{"BRN", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Licca-Chan no Oshare Nikki
+	{"BRO", 0, SaveType::NONE, 0, 0}, // NONE}            Postman Pat and the Greendale Rocket
+	{"BRP", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Liliput Oukoku
+	{"BRQ", 0, SaveType::NONE, 0, 0}, // NONE}            3 Games in One - Majesco's Rec Room Challenge
+	{"BRR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Bratz - Rock Angelz
+	{"BRS", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - SpongeBob SquarePants - Supersponge + Rugrats - Go Wild
+	{"BRT", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Robots
+	{"BRV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     That's So Raven
+	{"BRW", 0, SaveType::NONE, 0, 0}, // NONE}            Racing Fever
+	{"BRX", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Vattroller X
+	{"BRY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Rayman - Hoodlum's Revenge
+	{"BRZ", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - Power Rangers Time Force + Ninja Storm
+	{"BS3", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Simple 2960 Tomodachi Series Vol. 3 - The Itsudemo Puzzle
+	{"BS4", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Simple 2960 Tomodachi Series Vol. 4 - The Trump
+	{"BS5", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Sylvanian Family - Yousei no Stick to Fushigi no Ki
+	{"BS6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Backyard Skateboarding
+	{"BS7", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     2 in 1 Game Pack - Shark Tale + Shrek 2
+	{"BS8", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Spyro Advance - Wakuwaku Tomodachi
+	{"BSA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Super Chinese 1 - 2 Advance
+	{"BSB", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Sonic Battle
+	{"BSD", 0, SaveType::NONE, 0, 0}, // NONE}            Sitting Ducks
+	{"BSE", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Shrek 2
+	{"BSF", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Sylvania Family - Fashion Designer ni Naritai
+	{"BSG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Minna no Soft Series - Minna no Shogi
+	{"BSH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Shanghai
+	{"BSI", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Shrek 2 - Beg for Mercy
+	{"BSK", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Summon Night - Swordcraft Story 2
+	{"BSL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Tom Clancy's Splinter Cell - Pandora Tomorrow
+	{"BSM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Metal Slug Advance
+	{"BSN", 0, SaveType::NONE, 0, 0}, // NONE}            The SpongeBob SquarePants Movie
+	{"BSO", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Shaman King - Master of Spirits
+	{"BSP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Spider-Man 2
+	{"BSQ", 0, SaveType::NONE, 0, 0}, // NONE}            SpongeBob SquarePants - Battle for Bikini Bottom
+	{"BSR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Wade Hixton's Counter Punch
+	{"BSS", 0, SaveType::NONE, 0, 0}, // NONE}            Spy Muppets - License to Croak
+	{"BST", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Spyro Orange - The Cortex Conspiracy
+	{"BSU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Shark Tale
+	{"BSV", 0, SaveType::NONE, 0, 0}, // NONE}            Smashing Drive
+	{"BSW", 0, SaveType::NONE, 0, 0}, // NONE}            Star Wars - Flight of the Falcon
+	{"BSX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     SSX 3
+	{"BSY", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Sentouin - Yamada Hajime
+	{"BSZ", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - SpongeBob SquarePants - Supersponge + Battle for Bikini Bottom
+	{"BT2", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Teenage Mutant Ninja Turtles 2 - Battlenexus
+	{"BT3", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Tantei Jinguuji Saburou Shiroi Kage no Syoujyo
+	{"BT4", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Dragon Ball GT - Transformation
+	{"BT5", 0, SaveType::NONE, 0, 0}, // NONE}            2 Jeux en 1 - Titeuf - Ze Gag Machine + Mega Compet
+	{"BT6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Trollz - Hair Affair!
+	{"BT7", 0, SaveType::NONE, 0, 0}, // NONE}            Tonka - On the Job
+	{"BT8", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Teenage Mutant Ninja Turtles Double Pack
+	{"BT9", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Tak 2 - The Staff of Dreams
+	{"BTA", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Astro Boy - Omega Factor
+	{"BTB", 0, SaveType::NONE, 0, 0}, // NONE}            Thunderbirds
+	{"BTC", 0, SaveType::NONE, 0, 0}, // NONE}            Titeuf - Mega-Compet
+	{"BTD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Pocket Dogs
+	{"BTF", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Tokyo Majin Gakuen - Fuju Houroku
+	{"BTG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     TopGear Rally
+	{"BTH", 0, SaveType::NONE, 0, 0}, // NONE}            Thunder Alley
+	{"BTI", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Tantei Gakuen Q - Kyukyoku Trick ni Idome!
+	{"BTJ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Tringo
+	{"BTL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Minna no Soft Series - Happy Trump 20
+	{"BTM", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Mario Tennis - Power Tour
+	{"BTN", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Tron 2.0 - Killer App
+	{"BTO", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Tony Hawk's Underground
+	{"BTP", 0, SaveType::NONE, 0, 0}, // NONE}            Ten Pin Alley 2
+	{"BTQ", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Tantei Gakuen Q - Meitantei ha Kimi da!
+	{"BTR", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      The Tower SP
+	{"BTT", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Tetris Advance
+	{"BTU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Totally Spies
+	{"BTV", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Ty the Tasmanian Tiger 3 - Night of the Quinkan
+	{"BTW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Tiger Woods PGA Tour 2004
+	{"BTY", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Ty the Tasmanian Tiger 2 - Bush Rescue
+	{"BTZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Tokyo Xtreme Racer Advance
+	{"BU2", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     2 Games in 1 - Battle for Bikini Bottom + Nicktoons Freeze Frame Frenzy
+	{"BU4", 0, SaveType::NONE, 0, 0}, // NONE}            Unfabulous
+	{"BU5", 0, SaveType::NONE, 0, 0}, // NONE}            Uno 52
+	{"BU6", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Taiketsu! Ultra Hero
+	{"BU7", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V126     The Legend of Spyro - The Eternal Night
+	{"BUA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Ultimate Puzzle Games
+	{"BUC", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Ultimate Card Games
+	{"BUD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Konjiki no Gashbell!! Yuujou no Dengeki Dream Tag Tournament
+	{"BUE", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Danny Phantom - The Ultimate Enemy
+	{"BUF", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     2 Games in 1 - Dragon Ball Z - Buu's Fury + Dragon Ball GT - Transformation
+	{"BUH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Ueki no Housoku Shinki Sakuretsu! Nouryokumono Battle
+	{"BUI", 0, SaveType::NONE, 0, 0}, // NONE}            Uno Freefall
+	{"BUJ", 0, SaveType::NONE, 0, 0}, // NONE}            Nicktoons - Attack of the Toybots
+	{"BUL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Ultimate Spider-Man
+	{"BUM", 0, SaveType::NONE, 0, 0}, // NONE}            Monopoly
+	{"BUO", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Dr. Sudoku
+	{"BUQ", 0, SaveType::NONE, 0, 0}, // NONE}            2 Game Pack! Uno + Skip-Bo
+	{"BUR", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Paws & Claws - Pet Resort
+	{"BUS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Green Eggs and Ham by Dr. Seuss
+	{"BUT", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V131      Ultra Keibitai - Monster Attack
+	{"BUV", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Uchu no Stellvia
+	{"BUW", 0, SaveType::NONE, 0, 0}, // NONE}            Ultimate Winter Games
+	{"BUX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Bibi und Tina - Ferien auf dem Martinshof
+	{"BUY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Ant Bully
+	{"BUZ", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Ultimate Arcade Games
+	{"BVA", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       bit Generations - Coloris
+	{"BVB", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       bit Generations - Dial Hex
+	{"BVC", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       bit Generations - Dotstream
+	{"BVD", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       bit Generations - Boundish
+	{"BVE", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       bit Generations - Orbital
+	{"BVG", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       bit Generations - Soundvoyager
+	{"BVH", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       bit Generations - Digidrive
+	{"BW2", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - Cartoon Network - Block Party + Speedway
+	{"BW3", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V133      2 Games in 1 - Sonic Advance + Chu Chu Rocket
+	{"BW4", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V133      2 Games in 1 - Sonic Battle + Sonic Advance
+	{"BW5", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V133      Combo Pack - Sonic Advance + Sonic Pinball Party
+	{"BW6", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V133      2 Games in 1 - Sonic Pinball Party + Sonic Battle
+	{"BW7", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V133      2 Games in 1 - Sonic Battle + ChuChu Rocket!
+	{"BW8", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V133      2 Games in 1 - Sonic Pinball + Columns Crown
+	{"BW9", 0, SaveType::Flash_512k_Panasonic, 0, 0}, // FLASH_V133      2 Games in 1 - Columns Crown + ChuChu Rocket!
+	{"BWA", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Kisekae Angel Series 1 - Wannyan Aidoru Gakuen
+	{"BWB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     2 Games in 1 - Brother Bear + Disney Princess
+	{"BWC", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - Golden Nugget Casino - Texas Hold'em Poker
+	{"BWD", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     Wan Nyan Doubutsu Byouin
+	{"BWE", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Whac-A-Mole
+	{"BWF", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Wagamama Fairy Mirumo de Pon! Yume no Kakera
+	{"BWH", 0, SaveType::NONE, 0, 0}, // NONE}            Winnie the Pooh's Rumbly Tumbly Adventure
+	{"BWI", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     WinX Club
+	{"BWJ", 0, SaveType::NONE, 0, 0}, // NONE}            Who Wants to Be a Millionaire - Junior
+	{"BWK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Wanko Dekururi! Wankuru
+	{"BWL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Wild
+	{"BWM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     WanWan Meitantei
+	{"BWN", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Twin Series 6 - Wan Nyon Idol Gakuen + Koinu Toissho Special
+	{"BWO", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     World Poker Tour
+	{"BWP", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Wagamama Fairy Mirumo de Pon Nazo no Kagi to Shinjitsu no Tobir
+	{"BWQ", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - Quad Desert Fury + Monster Trucks
+	{"BWR", 0, SaveType::NONE, 0, 0}, // NONE}            World Reborn
+	{"BWS", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Shaman King - Legacy of the Spirits - Sprinting Wolf
+	{"BWU", 0, SaveType::NONE, 0, 0}, // NONE}            Die wilden Fussballkerle - Entscheidung im Teufelstopf
+	{"BWV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Winx Club - Quest For The Codex
+	{"BWW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     WWE Survivor Series
+	{"BWX", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Wanko Mix Chiwanko World
+	{"BWY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Winter Sports
+	{"BWZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Winnie the Pooh's Rumbly Tumbly Adventure + Rayman 3
+	{"BX2", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     2 in 1 - Spider-Man Mysterio's Menace & X2 Wolverine's Revenge
+	{"BX3", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V125     2 in 1 GamePack - Spider-Man + Spider-Man 2
+	{"BX4", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V122     2 in 1 - Tony Hawk's Underground + Kelly Slater's Pro Surfer
+	{"BX5", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Rayman - 10th Anniversary
+	{"BX6", 0, SaveType::NONE, 0, 0}, // NONE}            2 Games in 1 - Battle for Bikini Bottom + Breakin' Da Rules
+	{"BXA", 0, SaveType::NONE, 0, 0}, // NONE}            Texas Hold 'Em Poker
+	{"BXC", 0, SaveType::NONE, 0, 0}, // NONE}            3 Game Pack! - Ker Plunk! + Toss Across + Tip It
+	{"BXF", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Bratz - Forever Diamondz
+	{"BXG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     2 in 1 Fun Pack - Madagascar + Shrek 2
+	{"BXH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     2 in 1 Fun Pack - Madagascar - Operation Penguin + Shrek 2
+	{"BXK", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Castlevania Double Pack
+	{"BXM", 0, SaveType::NONE, 0, 0}, // NONE}            XS Moto
+	{"BXP", 0, SaveType::NONE, 0, 0}, // NONE}            Dora the Explorer - Dora's World Adventure
+	{"BXS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Tony Hawk's Downhill Jam
+	{"BXU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Surf's Up
+	{"BXW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Die Wilden Fussball Kerle - Gefahr im Wilde Kerle Land
+	{"BY2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V102       Yu-Gi-Oh! Double Pack
+	{"BY3", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Yu-Gi-Oh! Duel Monsters Expert 3
+	{"BY6", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Yu-Gi-Oh! Ultimate Masters 2006
+	{"BY7", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Yu-Gi-Oh! 7 Trials to Glory - World Championship Tournament 2005
+	{"BYA", 0, SaveType::NONE, 0, 0}, // NONE}            F24 - Stealth Fighter
+	{"BYD", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Yu-Gi-Oh! - Destiny Board Traveler
+	{"BYF", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Backyard NFL Football 2006
+	{"BYG", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Yu-Gi-Oh! GX - Duel Academy
+	{"BYH", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Backyard Hockey
+	{"BYI", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Yu-Gi-Oh! Duel Monsters International 2
+	{"BYL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Kid Paddle
+	{"BYM", 0, SaveType::NONE, 0, 0}, // NONE}            Monster Trucks Mayhem
+	{"BYO", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Yu-Gi-Oh! Day Of The Duelist - World Championship Tournament 2005
+	{"BYP", 0, SaveType::EEPROM_8k, 0, 0}, // EEPROM_V124     Horse & Pony - Let's Ride 2
+	{"BYS", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Yu-Gi-Oh! Sugoroku no Sugoroku
+	{"BYU", 0, SaveType::EEPROM_8k, 0, 0}, // EEPROM_V126     Yggdra Union - We'll Never Fight Alone
+	{"BYV", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Yo-Gi-Oh! Double Pack 2 - Destiny Board Traveler + Dungeon Dice Monsters
+	{"BYW", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Yu-Gi-Oh! World Championship Tournament 2004
+	{"BYX", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Puppy Luv - Spa and Resort
+	{"BYY", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Yu Yu Hakusho - Spirit Detective
+	{"BZ2", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Zettai Zetsumei Den Chara Suji-Sa
+	{"BZ3", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Megaman Zero 3
+	{"BZ4", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Final Fantasy IV Advance
+	{"BZ5", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Final Fantasy V Advance
+	{"BZ6", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Final Fantasy VI Advance
+	{"BZC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     The Suite Life of Zack & Cody - Tipton Trouble
+	{"BZD", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Zettai Zetsumei Dangerous Jiisan - Shijou Saikyou no Togeza
+	{"BZF", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V103       Zoids Saga - Fuzors
+	{"BZG", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Zettai Zetsumei Dangerous Jiisan - Zettai Okujou Bai Orensu Kouchou
+	{"BZI", 0, SaveType::NONE, 0, 0}, // NONE}            Finding Nemo - The Continuing Adventures
+	{"BZM", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     The Legend of Zelda - The Minish Cap
+	{"BZN", 0, SaveType::NONE, 0, 0}, // NONE}            Deal or No Deal
+	{"BZO", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Zero One SP
+	{"BZP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     2 Games in 1 - Dr. Mario + Puzzle League
+	{"BZR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Enchanted - Once Upon Andalasia
+	{"BZS", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Thats So Raven 2 - Supernatural Style
+	{"BZT", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     VeggieTales - LarryBoy and the Bad Apple
+	{"BZU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Teen Titans 2
+	{"BZW", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Akagi
+	{"BZX", 0, SaveType::NONE, 0, 0}, // NONE}            SpongeBob's Atlantis Squarepantis
+	{"BZY", 0, SaveType::NONE, 0, 0}, // NONE}            Zoey 101
+	{"FAD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Classic NES Series - Castlevania
+	{"FBF", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 13 - Balloon Fight
+	{"FBM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Classic NES Series - Bomberman
+	{"FCL", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 12 - Clu Clu Land
+	{"FDD", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 16 - Dig Dug
+	{"FDK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Classic NES Series - Donkey Kong
+	{"FDM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Classic NES Series - Dr. Mario
+	{"FEB", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Classic NES Series - ExciteBike
+	{"FFM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 26 - Mukashi Hanashi - Shin Onigashima
+	{"FGG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 20 - Ganbare Goemon! Karakuri Douchuu
+	{"FGZ", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series - Kido Senshi Z Gundam Hot Scramble
+	{"FIC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Classic NES Series - Ice Climber
+	{"FLB", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Classic NES Series - Zelda II - The Adventure of Link
+	{"FM2", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 21 - Super Mario Bros. 2
+	{"FMB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 11 - Mario Bros.
+	{"FMK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 18 - Makaimura
+	{"FMP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 8 - Mappy
+	{"FMR", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Classic NES Series - Metroid
+	{"FNM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 22 - Nazo no Murasame Shiro
+	{"FP7", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Classic NES Series - Pac-Man
+	{"FPM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 6 - Pac-Man
+	{"FPT", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Famicom Mini Series 24 - Hikari Shinwa - Palutena no Kagame
+	{"FSD", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Famicom Mini Series 30 - SD Gundam World - Gachapon Senshi Scramble Wars
+	{"FSM", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Classic NES Series - Super Mario Bros.
+	{"FSO", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Famicom Mini Series 10 - Star Soldier
+	{"FSR", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Famicom Mini Series - Dai 2 Ji Super Robot Taisen
+	{"FTB", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 17 - Takahashi Meijin no Bouken Jima
+	{"FTK", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 27 - Famicom Tantei Club - Kieta Koukeisha
+	{"FTU", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 28 - Famicom Tantei Club Part II - Ushiro ni Tatsu Shoujo
+	{"FTW", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 19 - TwinBee
+	{"FWC", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Famicom Mini Series 14 - Wrecking Crew
+	{"FXV", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Classic NES Series - Xevious
+	{"FZL", 0, SaveType::EEPROM_4k_alt, 0, 0}, // EEPROM_V124     Classic NES Series - The Legend of Zelda
+	{"KHP", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V122     Koro Koro Puzzle - Happy Panechu!
+	{"KYG", 0, SaveType::EEPROM_4k, 0, 0}, // EEPROM_V124     Yoshi Topsy-Turvy
+	{"M2S", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Shrek 2
+	{"MC2", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Cartoon Network Collection - Volume 2
+	{"MCM", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Cartoon Network Collection - Limited Edition
+	{"MCN", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Cartoon Network Collection - Platinum Edition
+	{"MCP", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Cartoon Network Collection - Premium Edition
+	{"MCS", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Cartoon Network Collection - Special Edition
+	{"MCT", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Cartoon Network Collection - Volume 1
+	{"MDB", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Dragon Ball GT - Volume 1
+	{"MDC", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Disney Channel Collection - Volume 1
+	{"MDR", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Dora the Explorer - Volume 1
+	{"MDS", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Disney Channel Collection - Volume 2
+	{"MF2", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - The Fairly Odd Parents - Volume 2
+	{"MFO", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - The Fairly Odd Parents - Volume 1
+	{"MFP", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - The Proud Family - Volume 1
+	{"MGU", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - All Grown Up - Volume 1
+	{"MJM", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - The Adventures of Jimmy Neutron Boy Genius - Volume 1
+	{"MKD", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Codename Kids Next Door - Volume 1
+	{"MN2", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Nicktoons Collection - Volume 2
+	{"MN3", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Nicktoons Volume 3
+	{"MNC", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Nicktoon's Collection - Volume 1
+	{"MPA", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Pokemon - Volume 1
+	{"MPB", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Pokemon - Volume 2
+	{"MPC", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Pokemon - Volume 3
+	{"MPD", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Pokemon - Volume 4
+	{"MS2", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - SpongeBob SquarePants - Volume 2
+	{"MS3", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - SpongeBob SquarePants - Volume 3
+	{"MSA", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Shark Tale
+	{"MSB", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Strawberry Shortcake - Volume 1
+	{"MSH", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Sonic X - Volume 1
+	{"MSK", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Shrek
+	{"MSR", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Super Robot Monkey Team - Volume 1
+	{"MSS", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - SpongeBob SquarePants - Volume 1
+	{"MST", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Shrek + Shark Tale
+	{"MTM", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Teenage Mutant Ninja Turtles - Volume 1
+	{"MYG", 0, SaveType::NONE, 0, 0}, // NONE}            GBA Video - Yu-Gi-Oh! - Yugi vs. Joey - Volume 1
+	{"PEA", 0, SaveType::Flash_512k_SST, 0, 0}, // FLASH_V124      Card E-Reader
+	{"PSA", 0, SaveType::Flash_1M_Macronix_RTC, GAME_RTC, 0}, // FLASH_V103      E-Reader
+	{"RZW", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       WarioWare Twisted!
+	{"U32", 0, SaveType::EEPROM_4k_alt, GAME_RTC, 0}, // EEPROM_V124     Boktai 2 - Solar Boy Django
+	{"U33", 0, SaveType::EEPROM_4k_alt, GAME_RTC, 0}, // EEPROM_V124     Shin Bokura no Taiyou - Gyakushuu no Sabata
+	{"U3I", 0, SaveType::EEPROM_4k_alt, GAME_RTC, 0}, // EEPROM_V122     Boktai - The Sun is in Your Hand
+	{"V49", 0, SaveType::SRAM_256K, 0, 0}, // SRAM_V113       Drill Dozer
+	{"XXX", 0, SaveType::NONE, 0, 0}, // NONE}            Kien
+};
+
+#define NUM_GAMES (sizeof(games) / sizeof(games[0]))
+
+static constexpr s32 compareCode(const char* a, const char* b)
+{
+	for (s32 i = 0; i < 3; i++) {
+		if (a[i] != b[i])
+			return (u8)a[i] < (u8)b[i] ? -1 : 1;
+	}
+	return 0;
+}
+
+static constexpr bool gamesSorted()
+{
+	for (u32 i = 1; i < NUM_GAMES; i++) {
+		s32 order = compareCode(games[i - 1].code, games[i].code);
+		if (order > 0 || (order == 0 && games[i - 1].crc >= games[i].crc))
+			return false;
+	}
+	return true;
+}
+
+static_assert(gamesSorted(), "game database must be sorted by code then crc without duplicates");
+
+const GameEntry* lookupGame(const std::string& gameCode, u32 crc)
+{
+	if (gameCode.size() < 3)
+		return nullptr;
+
+	const char* code = gameCode.c_str();
+	const GameEntry* first = std::lower_bound(games, games + NUM_GAMES, code,
+		[](const GameEntry& entry, const char* key) { return compareCode(entry.code, key) < 0; });
+
+	//Entries for the same code are sorted by crc, GAME_ANY_CRC first
+	const GameEntry* match = nullptr;
+	for (const GameEntry* entry = first; entry != games + NUM_GAMES; entry++) {
+		if (compareCode(entry->code, code) != 0)
+			break;
+		if (entry->crc == GAME_ANY_CRC)
+			match = entry;
+		else if (entry->crc == crc)
+			return entry;
+	}
+	return match;
+}
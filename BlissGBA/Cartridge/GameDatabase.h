@@ -0,0 +1,21 @@
+#pragma once
+#include "Backups/SaveDetector.h"
+
+#define GAME_ANY_CRC 0 //entry applies to every dump of the game code
+
+//Per game hints
+#define GAME_RTC 0x1 //real time clock on the gpio port
+
+/*
+	Known game, keyed by game code (without the region byte) and rom crc32.
+	Entries with a crc override the GAME_ANY_CRC entry of the same code
+*/
+struct GameEntry {
+	char code[4];
+	u32 crc;
+	SaveType saveType;
+	u8 flags;
+	u32 idleLoop; //address of the loop the game waits for interrupts in, 0 if unknown
+};
+
+const GameEntry* lookupGame(const std::string& gameCode, u32 crc);
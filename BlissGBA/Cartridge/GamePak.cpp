@@ -1,13 +1,9 @@
 #include "GamePak.h"
+#include "../Utils/Crc32.h"
 
 GamePak::GamePak(MemoryBus *mbus)
-	:gamepakWS0(nullptr),
-	gamepakWS1(nullptr),
-	gamepakWS2(nullptr),
-	gamepakSRAM(nullptr),
-	rtc(mbus)
+	:rtc(mbus)
 { 
-	setupSaveDatabase();
 }	
 
 GamePak::~GamePak()
@@ -15,126 +11,210 @@ GamePak::~GamePak()
 	zeroMemory();
 }
 
+static std::string saveFileName(const std::string& romName)
+{
+	size_t dot = romName.find_last_of('.');
+	size_t separator = romName.find_last_of("/\\");
+	if (dot == std::string::npos || (separator != std::string::npos && dot < separator))
+		return romName + ".sav";
+	return romName.substr(0, dot) + ".sav";
+}
+
 void GamePak::load(const std::string& fileName)
 {
 	zeroMemory();
 
-	std::ifstream file(fileName, std::ios::binary | std::ios::ate);
-	if (file.is_open()) {
-		u32 size = file.tellg();
-		file.seekg(0, file.beg);
-		
-		if (size > GAMEPAK_WS_SIZE * 3) {
-			std::cerr << "GamePak file too large!" << std::endl;
-			return;
-		}
+	if (!rom.open(fileName)) {
+		std::cerr << "Rom/File <" << fileName << " failed to open\n";
+		return;
+	}
 
-		bool loaded = false;
-		if (size <= GAMEPAK_WS_SIZE) {
-			loaded = true;
-			gamepakWS0 = new u8[GAMEPAK_WS_SIZE];
-			gamepakSRAM = new u8[GAMEPAK_SRAM_SIZE];
-			file.read((char*)gamepakWS0, GAMEPAK_WS_SIZE);
-		}
+	if (rom.size > GAMEPAK_WS_SIZE) {
+		std::cerr << "GamePak file too large!" << std::endl;
+		rom.close();
+		return;
+	}
 
-		if (loaded)
-			parseHeader(size);
+	parseHeader(rom.size);
 
-		file.close();
-	}
-	else {
-		std::cerr << "Rom/File <" << fileName << " failed to open\n";
+	//Reads the rom once through the page cache, nothing is copied
+	crc = crc32(rom.data, rom.size);
+	game = lookupGame(header.game_code, crc);
+	//The database entry decides, only unknown games are scanned for the sdk rtc library
+	if (game != nullptr)
+		has_rtc_chip = (game->flags & GAME_RTC) != 0;
+	else
+		has_rtc_chip = scanRtc(rom.data, rom.size);
+	if (has_rtc_chip) {
+		gpioStart = (u32)GpioAddress::Data;
+		rtc.reset();
 	}
+	selectRomReads();
+	saveType = detectSavetype(*this);
+
+	//Without a known save type keep an sram in memory so the game still runs
+	u32 saveSize = saveTypeSize(saveType);
+	if (saveSize == 0)
+		save.open("", GAMEPAK_SRAM_SIZE);
+	else
+		save.open(saveFileName(fileName), saveSize);
+	flash.reset(&save, saveType);
+	eeprom.reset(&save, saveType);
+	if (isEeprom(saveType))
+		eepromStart = (rom.size > 0x1000000) ? EEPROM_LARGE_ROM_START_ADDR : EEPROM_START_ADDR;
 }
 
 void GamePak::writeU8(u32 address, u8 value)
 {
-	if (address >= (u32)GpioAddress::Data && address <= (u32)GpioAddress::Control) {
-		has_rtc_chip = true;
+	if (isGpioAddress(address))
 		rtc.write((GpioAddress)address, value);
-	}
 
-	if (address >= GAMEPAK_SRAM_START_ADDR && address <= GAMEPAK_SRAM_END_ADDR) {
-		u32 addr = address & (GAMEPAK_SRAM_SIZE - 1);
-		gamepakSRAM[addr] = value;
-	}
+	if (address >= GAMEPAK_SRAM_START_ADDR && address <= GAMEPAK_BACKUP_END_ADDR)
+		writeBackup(address, value);
 }
 
 void GamePak::writeU16(u32 address, u16 value)
 {
-	if (address >= (u32)GpioAddress::Data && address <= (u32)GpioAddress::Control) {
-		has_rtc_chip = true;
+	if (isGpioAddress(address))
 		rtc.write((GpioAddress)address, value);
-	}
+
+	if (isEepromAddress(address))
+		eeprom.write(value);
+
+	//8 bit bus, only the byte lane of the address is written
+	if (address >= GAMEPAK_SRAM_START_ADDR && address <= GAMEPAK_BACKUP_END_ADDR)
+		writeBackup(address, value >> ((address & 0x1) * 8));
 }
 
 void GamePak::writeU32(u32 address, u32 value)
 {
-	if (address >= (u32)GpioAddress::Data && address <= (u32)GpioAddress::Control) {
-		has_rtc_chip = true;
+	if (isGpioAddress(address))
 		rtc.write((GpioAddress)address, value);
-	}
+
+	if (address >= GAMEPAK_SRAM_START_ADDR && address <= GAMEPAK_BACKUP_END_ADDR)
+		writeBackup(address, value >> ((address & 0x3) * 8));
 }
 
 u8 GamePak::readU8(u32 address)
 {
 	if (address >= GAMEPAK_WS0_START_ADDR && address <= GAMEPAK_WS2_END_ADDR) {
-		if (address >= (u32)GpioAddress::Data && address <= (u32)GpioAddress::Control) {
-			if (has_rtc_chip)
-				return rtc.read((GpioAddress)address);
-		}
-
-		u32 addr = address & (GAMEPAK_WS_SIZE - 1);
-		return gamepakWS0[addr];
+		return (this->*romReadU8)(address);
 	}
-	else if (address >= GAMEPAK_SRAM_START_ADDR && address <= GAMEPAK_SRAM_END_ADDR) {
-		u32 addr = address & (GAMEPAK_SRAM_SIZE - 1);
-		//stub flash for now
-		if (address == 0x0E000000)
-			return 0x62;
-		else if (address == 0x0E000001)
-			return 0x13;
-	
-		return gamepakSRAM[addr];
+	else if (address >= GAMEPAK_SRAM_START_ADDR && address <= GAMEPAK_BACKUP_END_ADDR) {
+		return readBackup(address);
 	}
+	return 0;
 }
 
 u16 GamePak::readU16(u32 address)
 {
 	if (address >= GAMEPAK_WS0_START_ADDR && address <= GAMEPAK_WS2_END_ADDR) {
-		if (address >= (u32)GpioAddress::Data && address <= (u32)GpioAddress::Control) {
-			if (has_rtc_chip)
-				return rtc.read((GpioAddress)address);
-		}
-
-		u32 addr = address & (GAMEPAK_WS_SIZE - 1);
-
-		u8 lo = gamepakWS0[addr];
-		u8 hi = gamepakWS0[addr + 1];
-		u16 value = (hi << 8) | lo;
-
-		return value;
+		return (this->*romReadU16)(address);
+	}
+	else if (address >= GAMEPAK_SRAM_START_ADDR && address <= GAMEPAK_BACKUP_END_ADDR) {
+		//8 bit bus, the byte is repeated on every lane
+		return readBackup(address) * 0x0101;
 	}
+	return 0;
 }
 
 u32 GamePak::readU32(u32 address)
 {
 	if (address >= GAMEPAK_WS0_START_ADDR && address <= GAMEPAK_WS2_END_ADDR) {
-		if (address >= (u32)GpioAddress::Data && address <= (u32)GpioAddress::Control) {
-			if (has_rtc_chip)
-				return rtc.read((GpioAddress)address);
-		}
+		return (this->*romReadU32)(address);
+	}
+	else if (address >= GAMEPAK_SRAM_START_ADDR && address <= GAMEPAK_BACKUP_END_ADDR) {
+		return readBackup(address) * 0x01010101;
+	}
+	return 0;
+}
 
-		u32 addr = address & (GAMEPAK_WS_SIZE - 1);
+template<bool Gpio>
+u8 GamePak::readRomU8(u32 address)
+{
+	if (Gpio && isGpioAddress(address))
+		return rtc.read((GpioAddress)address);
 
-		u8 byte1 = gamepakWS0[addr];
-		u8 byte2 = gamepakWS0[addr + 1];
-		u8 byte3 = gamepakWS0[addr + 2];
-		u8 byte4 = gamepakWS0[addr + 3];
+	u32 addr = address & (GAMEPAK_WS_SIZE - 1);
+	return *rom.at(addr);
+}
 
-		u32 value = ((byte4 << 24) | (byte3 << 16) | (byte2 << 8) | byte1);
+template<bool Gpio>
+u16 GamePak::readRomU16(u32 address)
+{
+	if (Gpio && isGpioAddress(address))
+		return rtc.read((GpioAddress)address);
+
+	if (isEepromAddress(address))
+		return eeprom.read();
+
+	u32 addr = address & (GAMEPAK_WS_SIZE - 1);
+
+	const u8* bytes = rom.at(addr, 2);
+	u8 lo = bytes[0];
+	u8 hi = bytes[1];
+	u16 value = (hi << 8) | lo;
+
+	return value;
+}
+
+template<bool Gpio>
+u32 GamePak::readRomU32(u32 address)
+{
+	if (Gpio && isGpioAddress(address))
+		return rtc.read((GpioAddress)address);
+
+	u32 addr = address & (GAMEPAK_WS_SIZE - 1);
 
-		return value;
+	const u8* bytes = rom.at(addr, 4);
+	u8 byte1 = bytes[0];
+	u8 byte2 = bytes[1];
+	u8 byte3 = bytes[2];
+	u8 byte4 = bytes[3];
+
+	u32 value = ((byte4 << 24) | (byte3 << 16) | (byte2 << 8) | byte1);
+
+	return value;
+}
+
+void GamePak::selectRomReads()
+{
+	if (has_rtc_chip) {
+		romReadU8 = &GamePak::readRomU8<true>;
+		romReadU16 = &GamePak::readRomU16<true>;
+		romReadU32 = &GamePak::readRomU32<true>;
+	}
+	else {
+		romReadU8 = &GamePak::readRomU8<false>;
+		romReadU16 = &GamePak::readRomU16<false>;
+		romReadU32 = &GamePak::readRomU32<false>;
+	}
+}
+
+u8 GamePak::readBackup(u32 address)
+{
+	if (save.data == nullptr)
+		return 0xFF;
+	if (isFlash(saveType))
+		return flash.read(address);
+	//Eeprom sits on the rom bus, nothing answers here
+	if (isEeprom(saveType))
+		return 0xFF;
+
+	return save.data[address & (GAMEPAK_SRAM_SIZE - 1)];
+}
+
+void GamePak::writeBackup(u32 address, u8 value)
+{
+	if (save.data == nullptr)
+		return;
+	if (isFlash(saveType)) {
+		flash.write(address, value);
+	}
+	else if (!isEeprom(saveType)) {
+		u32 addr = address & (GAMEPAK_SRAM_SIZE - 1);
+		save.data[addr] = value;
+		save.markDirty(addr);
 	}
 }
 
@@ -167,37 +247,26 @@ void GamePak::parseHeader(u32 size)
 			romSize = sizeStr + "MB";
 		}
 	}
+	header = RomHeader();
 	for (s32 i = 0; i < 12; i++)
-		header.game_title.push_back((char)gamepakWS0[i + 0xA0]);
+		header.game_title.push_back((char)*rom.at(i + 0xA0));
 
 	for (s32 i = 0; i < 4; i++)
-		header.game_code.push_back((char)gamepakWS0[i + 0xAC]);
+		header.game_code.push_back((char)*rom.at(i + 0xAC));
 
-	header.maker_code.push_back((char)gamepakWS0[0 + 0xB0]);
-	header.maker_code.push_back((char)gamepakWS0[1 + 0xB0]);
+	header.maker_code.push_back((char)*rom.at(0 + 0xB0));
+	header.maker_code.push_back((char)*rom.at(1 + 0xB0));
 }
 
 void GamePak::zeroMemory()
 {
-	if (gamepakWS0) delete gamepakWS0;
-	if (gamepakWS1) delete gamepakWS1;
-	if (gamepakWS2) delete gamepakWS2;
-	if (gamepakSRAM) delete gamepakSRAM;
-
-	gamepakWS0 = nullptr;
-	gamepakWS1 = nullptr;
-	gamepakWS2 = nullptr;
-	gamepakSRAM = nullptr;
-}
-
-void writeSRAMToDisk(u8* sram, u8 length)
-{
-	std::ofstream file;
-	file.open("game.sav", std::ios::binary);
-	if (file.is_open()) {
-		file.write((const char*)sram, length);
-	}
-	else {
-		std::cerr << "--Writing SRAM to Disk failed--" << std::endl;;
-	}
+	rom.close();
+	crc = 0;
+	game = nullptr;
+	saveType = SaveType::NONE;
+	eepromStart = 0xFFFFFFFF;
+	has_rtc_chip = false;
+	gpioStart = GPIO_UNMAPPED;
+	selectRomReads();
+	save.close();
 }
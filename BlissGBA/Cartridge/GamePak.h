@@ -1,6 +1,10 @@
 #pragma once
 #include "Rtc.h"
+#include "RomImage.h"
+#include "GameDatabase.h"
 #include "Backups\SaveDetector.h"
+#include "Backups\Flash.h"
+#include "Backups\CartridgeBackup.h"
 
 #define GAMEPAK_WS_SIZE 0x2000000 //game pak rom wait state
 #define GAMEPAK_WS0_START_ADDR 0x8000000
@@ -13,6 +17,14 @@
 #define GAMEPAK_SRAM_SIZE 0x8000
 #define GAMEPAK_SRAM_START_ADDR 0xE000000
 #define GAMEPAK_SRAM_END_ADDR 0xE007FFF
+#define GAMEPAK_BACKUP_END_ADDR 0xE00FFFF //sram is mirrored, flash uses all 64KB
+
+class GamePak;
+
+//Rom read routines, one is picked per width when a rom is loaded
+using RomReadU8 = u8(GamePak::*)(u32 address);
+using RomReadU16 = u16(GamePak::*)(u32 address);
+using RomReadU32 = u32(GamePak::*)(u32 address);
 
 struct RomHeader {
 	std::string game_title;
@@ -32,19 +44,52 @@ public:
 	u8 readU8(u32 address);
 	u16 readU16(u32 address);
 	u32 readU32(u32 address);
-	u8* getGamePakWS0() { return &gamepakWS0[0]; }
+	//Carts without gpio get the plain reads, which never look at the port
+	template<bool Gpio> u8 readRomU8(u32 address);
+	template<bool Gpio> u16 readRomU16(u32 address);
+	template<bool Gpio> u32 readRomU32(u32 address);
+	void selectRomReads();
+
+	const u8* getGamePakWS0() const { return rom.data; }
+	u32 getRomSize() const { return rom.size; }
+
+	inline bool isGpioAddress(u32 address) const
+	{
+		return (address - gpioStart) < GPIO_WINDOW_SIZE;
+	}
+
+	inline bool isEepromAddress(u32 address) const
+	{
+		return address >= eepromStart && address <= EEPROM_END_ADDR;
+	}
+
+	//Sram/flash, on an 8 bit bus
+	u8 readBackup(u32 address);
+	void writeBackup(u32 address, u8 value);
 
 	void parseHeader(u32 size);
 	void zeroMemory();
 
 	RomHeader header;
 	std::string romSize;
+	u32 crc = 0;
+	const GameEntry* game = nullptr; //nullptr if the game isn't in the database
+	SaveType saveType = SaveType::NONE;
 
-	u8* gamepakWS0;
-	u8* gamepakWS1;
-	u8* gamepakWS2;
-	u8* gamepakSRAM;
+	//The same rom is mirrored in all three wait state regions
+	RomImage rom;
+	//Backup memory of the detected save type, kept in the .sav next to the rom
+	SaveFile save;
+	Flash flash;
+	Eeprom eeprom;
+	u32 eepromStart = 0xFFFFFFFF; //past EEPROM_END_ADDR without an eeprom
 
 	RtcDevice rtc;
 	bool has_rtc_chip = false;
+	//GpioAddress::Data when the cart has an rtc, writes of carts without
+	//one never look at the gpio port
+	u32 gpioStart = GPIO_UNMAPPED;
+	RomReadU8 romReadU8 = &GamePak::readRomU8<false>;
+	RomReadU16 romReadU16 = &GamePak::readRomU16<false>;
+	RomReadU32 romReadU32 = &GamePak::readRomU32<false>;
 };
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include "RomImage.h"
+
+//Open bus on the cartridge bus returns the low 16 bits of the halfword address.
+//A few bytes of padding let an access at the end of the page read over it
+static u8* buildOpenBusPage()
+{
+	static u8 page[ROM_OPEN_BUS_SIZE + 4];
+	for (u32 i = 0; i < ROM_OPEN_BUS_SIZE + 4; i += 2) {
+		u16 value = (i >> 1) & 0xFFFF;
+		page[i] = value & 0xFF;
+		page[i + 1] = value >> 8;
+	}
+	return page;
+}
+
+const u8* RomImage::openBus = buildOpenBusPage();
+
+RomImage::RomImage()
+	:data(nullptr),
+	size(0)
+{
+}
+
+bool RomImage::open(const std::string& fileName)
+{
+	close();
+
+	if (!file.open(fileName))
+		return false;
+	//Anything over 4GB can't be a rom, the caller rejects more than 32MB
+	if (file.size > 0xFFFFFFFF) {
+		close();
+		return false;
+	}
+
+	data = file.data;
+	size = (u32)file.size;
+	return true;
+}
+
+void RomImage::close()
+{
+	file.close();
+	data = nullptr;
+	size = 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "../Utils/MappedFile.h"
+
+#define ROM_OPEN_BUS_SIZE 0x20000 //one halfword for every value of (address >> 1) & 0xFFFF
+
+/*
+	A rom file mapped read only. Pages are only read in from disk when the game
+	touches them and every instance running the same rom shares them through
+	the page cache. Reads past the end of the rom come from one open bus page
+*/
+struct RomImage {
+	RomImage();
+	bool open(const std::string& fileName);
+	void close();
+
+	//Pointer to width bytes at offset, the open bus page if they're past the end
+	inline const u8* at(u32 offset, u8 width = 1) const
+	{
+		if (offset + width <= size)
+			return data + offset;
+		return openBus + (offset & (ROM_OPEN_BUS_SIZE - 1));
+	}
+
+	MappedFile file;
+	const u8* data;
+	u32 size;
+	static const u8* openBus;
+};
@@ -1,4 +1,29 @@
 #include "Rtc.h"
+#include "../Memory/MemoryBus.h"
+
+//Days since 1970-01-01 of a proleptic gregorian date
+static s64 daysFromCivil(s64 year, u32 month, u32 day)
+{
+	year -= month <= 2;
+	s64 era = (year >= 0 ? year : year - 399) / 400;
+	u32 yoe = (u32)(year - era * 400);
+	u32 doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+	u32 doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return era * 146097 + (s64)doe - 719468;
+}
+
+static void civilFromDays(s64 days, s64& year, u32& month, u32& day)
+{
+	days += 719468;
+	s64 era = (days >= 0 ? days : days - 146096) / 146097;
+	u32 doe = (u32)(days - era * 146097);
+	u32 yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+	u32 doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+	u32 mp = (5 * doy + 2) / 153;
+	day = doy - (153 * mp + 2) / 5 + 1;
+	month = mp < 10 ? mp + 3 : mp - 9;
+	year = (s64)yoe + era * 400 + (month <= 2);
+}
 
 RtcDevice::RtcDevice(MemoryBus* mbus)
 	:mbus(mbus)
@@ -9,17 +34,53 @@ RtcDevice::RtcDevice(MemoryBus* mbus)
 
 	rtc_regs = { 0 };
 
-	time(&curr_time);
-	local_time = localtime(&curr_time);
 	reset();
 }
 
 void RtcDevice::reset()
 {
-	rtc_regs.date_time[(u8)DateTimeByte::Day] = toBcd(local_time->tm_mday);
-	rtc_regs.date_time[(u8)DateTimeByte::Month] = toBcd(local_time->tm_mon + 1);
-	rtc_regs.date_time[(u8)DateTimeByte::Year] = toBcd(local_time->tm_year - 100);
-	rtc_regs.date_time[(u8)DateTimeByte::DayOfWeek] = toBcd(local_time->tm_wday);
+	baseCycles = mbus->cycles;
+	if (deterministic) {
+		baseSeconds = RTC_DETERMINISTIC_EPOCH;
+	}
+	else {
+		//The only time the host clock is read
+		time_t now = time(nullptr);
+		tm local = *localtime(&now);
+		baseSeconds = daysFromCivil(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday) * 86400
+			+ local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec;
+	}
+	latchDateTime();
+}
+
+void RtcDevice::setDeterministic(bool enable)
+{
+	deterministic = enable;
+	reset();
+}
+
+s64 RtcDevice::currentSeconds()
+{
+	return baseSeconds + (s64)((mbus->cycles - baseCycles) / RTC_CLOCK_RATE);
+}
+
+void RtcDevice::latchDateTime()
+{
+	s64 seconds = currentSeconds();
+	s64 days = seconds / 86400;
+	u32 secondOfDay = (u32)(seconds % 86400);
+
+	s64 year;
+	u32 month, day;
+	civilFromDays(days, year, month, day);
+
+	setDateTime(DateTimeByte::Year, toBcd((s32)(year % 100)));
+	setDateTime(DateTimeByte::Month, toBcd(month));
+	setDateTime(DateTimeByte::Day, toBcd(day));
+	setDateTime(DateTimeByte::DayOfWeek, toBcd((s32)((days + 4) % 7))); //1970-01-01 was a thursday
+	setDateTime(DateTimeByte::Hour, toBcd(secondOfDay / 3600));
+	setDateTime(DateTimeByte::Min, toBcd((secondOfDay / 60) % 60));
+	setDateTime(DateTimeByte::Sec, toBcd(secondOfDay % 60));
 }
 
 u8 RtcDevice::read(GpioAddress address)
@@ -130,8 +191,8 @@ void RtcDevice::handleCommandBegin(u8 command_byte)
 		switch ((final_command_byte >> 1) & 0x7) {
 			case 0: rtc_regs.reset = 0; break; //reset
 			case 1: register_length_bytes = 1; break; //control
-			case 2: register_length_bytes = 7; break; //date/time
-			case 3: register_length_bytes = 3; break; //time
+			case 2: register_length_bytes = 7; latchDateTime(); break; //date/time
+			case 3: register_length_bytes = 3; latchDateTime(); break; //time
 			case 6: requestInterrupt(mbus, GAMEPAK_INT); break; //gamepak irq
 		}
 	}
@@ -164,15 +225,18 @@ void RtcDevice::handleReadCommand()
 					: (gpio.data_register &= ~(1 << 1));
 			}
 			break; //control
-			case 3:
-			
+			case 3: {
+				//Hour, min, sec
+				u8 sampled_bit = 0;
+				if (current_n_byte < 3)
+					sampled_bit = (rtc_regs.date_time[(u8)DateTimeByte::Hour + current_n_byte] >> sample_reg_bit) & 0x1;
+
+				(sampled_bit == 1) ? (gpio.data_register |= (1 << 1))
+					: (gpio.data_register &= ~(1 << 1));
+			}
 			break; //time
 			case 7: {
-				//set sio in data register
-				setDateTime(DateTimeByte::Hour, toBcd(local_time->tm_hour));
-				setDateTime(DateTimeByte::Min, toBcd(local_time->tm_min));
-				setDateTime(DateTimeByte::Sec, toBcd(local_time->tm_sec));
-
+				//set sio in data register, the date/time was latched when the command began
 				u8 sampled_bit = 0;
 				switch (current_n_byte) {
 					//Date
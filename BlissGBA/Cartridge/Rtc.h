@@ -5,6 +5,11 @@
 #define IN 0
 #define OUT 1
 
+#define GPIO_WINDOW_SIZE 6 //data, direction and control, 16 bits each
+#define GPIO_UNMAPPED 0xFFFFFFFF
+#define RTC_CLOCK_RATE 16777216 //master clock cycles per second
+#define RTC_DETERMINISTIC_EPOCH 946684800 //2000-01-01 00:00:00, start of the rtc's range
+
 enum class GpioAddress {
 	Data = 0x80000C4,
 	Direction = 0x80000C6,
@@ -35,9 +40,17 @@ enum class DateTimeByte : u8 {
 	Sec = 6
 };
 
+/*
+	The clock runs off the emulated master clock, counted from a local time
+	captured once when the rtc is reset. The deterministic clock always starts
+	at RTC_DETERMINISTIC_EPOCH so replays see the same dates
+*/
 struct RtcDevice {
 	RtcDevice(MemoryBus* mbus);
 	void reset();
+	void setDeterministic(bool enable);
+	s64 currentSeconds();
+	void latchDateTime();
 	u8 read(GpioAddress address);
 	void write(GpioAddress address, u8 value);
 	void handleCommandBegin(u8 command_byte);
@@ -48,8 +61,9 @@ struct RtcDevice {
 	void setDateTime(DateTimeByte byte, u8 value);
 	u8 getDateTime(DateTimeByte byte);
 
-	time_t curr_time;
-	tm* local_time;
+	s64 baseSeconds; //local time in seconds since 1970 at baseCycles
+	u64 baseCycles;
+	bool deterministic = false;
 	GpioInterface gpio;
 	RtcRegisters rtc_regs;
 
@@ -1,5 +1,6 @@
 #include "Dma.h"
 #include "../Memory/MemoryBus.h"
+#include "../Utils/Log.h"
 
 DmaController::DmaController(MemoryBus* mbus)
 	:mbus(mbus)
@@ -13,15 +14,15 @@ void DmaController::handleDMA()
 	if (transfer) {
 		switch (channelToTransfer) {
 			case DmaChannel::CH0: {
-				printf("Handling DMA Channel 0...\n");
+				LOG_TRACE(LogCategory::Dma, "channel 0 transfer requested (not implemented)");
 			}
 			break;
 			case DmaChannel::CH1: {
-				printf("Handling DMA Channel 1...\n");
+				LOG_TRACE(LogCategory::Dma, "channel 1 transfer requested (not implemented)");
 			}
 			break;
 			case DmaChannel::CH2: {
-				printf("Handling DMA Channel 2...\n");
+				LOG_TRACE(LogCategory::Dma, "channel 2 transfer requested (not implemented)");
 			}
 			break;
 			case DmaChannel::CH3: {
@@ -45,7 +46,7 @@ void DmaController::handleDMA()
 					transfer = false;
 				}
 				else { //repeat transfer
-					printf("Repeat(DMA3)\n");
+					LOG_ERROR(LogCategory::Dma, "channel 3 repeat transfers are not implemented");
 					assert(false);
 				}
 			}
@@ -82,6 +83,15 @@ void DmaController::handleChannelTransfer(DmaChannel channel)
 }
 
 
+static inline s32 addressStep(AddrControl control, s32 unit)
+{
+	switch (control) {
+		case AddrControl::DECREMENT: return -unit;
+		case AddrControl::FIXED: return 0;
+		default: return unit;
+	}
+}
+
 void DmaController::makeTransfer(DmaChannel channel, AddrControl destControl, AddrControl sourceControl, u32 sourceAddr, u32 destAddr, u16 length,
 	u8 transferType)
 {
@@ -92,6 +102,30 @@ void DmaController::makeTransfer(DmaChannel channel, AddrControl destControl, Ad
 		}
 	}
 
+	//Eeprom requests/responses are one bit per halfword, hand them over in one piece
+	//instead of going through the bus for every bit
+	if (channel == DmaChannel::CH3 && transferType == 0x0 && length <= EEPROM_MAX_REQUEST_BITS) {
+		GamePak& pak = mbus->pak;
+		if (pak.isEepromAddress(destAddr)) {
+			u16 stream[EEPROM_MAX_REQUEST_BITS];
+			for (u32 i = 0; i < length; i++) {
+				stream[i] = mbus->readU16(sourceAddr);
+				sourceAddr += addressStep(sourceControl, 2);
+			}
+			pak.eeprom.writeStream(stream, length);
+			return;
+		}
+		if (pak.isEepromAddress(sourceAddr)) {
+			u16 stream[EEPROM_MAX_REQUEST_BITS];
+			pak.eeprom.readStream(stream, length);
+			for (u32 i = 0; i < length; i++) {
+				mbus->writeU16(destAddr, stream[i]);
+				destAddr += addressStep(destControl, 2);
+			}
+			return;
+		}
+	}
+
 	if (transferType == 0x0) { //16 bit transfer
 		if (sourceControl == AddrControl::FIXED) {
 			for (u32 i = 0; i <= (length * 2); i++) {
@@ -11,11 +11,13 @@ Emulator::Emulator(sf::RenderWindow *window, float displayScaleFactor)
 	debug.running = &running;
 	debug.showDebugger = &showDebugger;
 
-	//Pass dma/timer controller pointer to mmio so that mmio can
+	//Pass dma/timer controller/ppu pointer to mmio so that mmio can
 	//tell dma/timer when a specific event happens
 	mbus.mmio.connect(&cpu);
 	mbus.mmio.connect(&dmac);
 	mbus.mmio.connect(&tmc);
+	mbus.mmio.connect(&ppu);
+	mbus.displayMem.connect(&ppu);
 
 	//Cpu/irq Test roms
 	//mbus.loadGamePak("test_roms/gba-tests-master/arm/arm.gba"); //pass
@@ -86,16 +88,35 @@ void Emulator::run()
 	if (running) {
 		s32 cycles_this_frame = 0;
 		while (cycles_this_frame < maxCycles) {
-			if (debuggerRunning)
+			//Outside pages holding a breakpoint this is one bit test
+			if (breakpoints.armed) {
+				u32 pc = (cpu.getState() == State::ARM) ? cpu.R15 - 8 : cpu.R15 - 4;
+				if (breakpoints.check(pc)) {
+					debug.breakpointHit(pc);
+					break;
+				}
+			}
+			if (debuggerRunning && debug.needsUpdate()) {
 				debug.update();
+				if (!running) break;
+			}
 	
 			u8 cycles = cpu.clock();
 			cycles_this_frame += cycles;
+			mbus.cycles += cycles;
 
 			tmc.handleTimers(cycles);
 			ppu.update(cycles);
-			cpu.handleInterrupts();
+			//Only look at the cpu side (IME, cpsr) once something is requested and enabled
+			if (mbus.mmio.interrupts.pending)
+				cpu.handleInterrupts();
 			dmac.handleDMA();
+
+			//Set by the memory bus during the instruction or dma above
+			if (mbus.watchpoints.triggered) {
+				debug.watchpointHit();
+				break;
+			}
 		}
 
 		joypad.update();
@@ -115,6 +136,11 @@ void Emulator::reset()
 {
 	cpu.reset();
 	ppu.reset();
+	mbus.mmio.interrupts.reset();
+	//Restart the master clock and rebase the rtc on it, a deterministic
+	//rtc then starts from its epoch again on every run
+	mbus.cycles = 0;
+	mbus.pak.rtc.reset();
 }
 
 void Emulator::handleEvents(sf::Event& ev)
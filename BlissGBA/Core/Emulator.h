@@ -20,6 +20,7 @@ public:
 	TimerController tmc;
 	Joypad joypad;
 	DebugUI debug;
+	Breakpoints breakpoints;
 
 	bool debuggerRunning;
 	bool showDebugger; //if false, emulator will render full screen
@@ -1,9 +1,43 @@
 #include "Interrupts.h"
 #include "../Memory/MemoryBus.h"
 
+InterruptController::InterruptController()
+{
+	reset();
+}
+
+void InterruptController::reset()
+{
+	ie = 0;
+	irqFlag = 0;
+	ime = 0;
+	update();
+}
+
+void InterruptController::request(u8 interrupt)
+{
+	irqFlag = setBit(irqFlag, interrupt);
+	update();
+}
+
+void InterruptController::acknowledge(u16 mask)
+{
+	irqFlag &= ~mask;
+	update();
+}
+
+void InterruptController::writeIE(u16 value)
+{
+	ie = value & 0x3FFF;
+	update();
+}
+
+void InterruptController::writeIME(u32 value)
+{
+	ime = value & 0x1;
+}
+
 void requestInterrupt(MemoryBus* mbus, u8 interrupt)
 {
-	u16 irq_flag = mbus->mmio.readIF();
-	irq_flag = setBit(irq_flag, interrupt);
-	mbus->mmio.writeIF(irq_flag);
+	mbus->mmio.interrupts.request(interrupt);
 }
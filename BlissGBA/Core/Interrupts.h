@@ -26,4 +26,27 @@
 
 class MemoryBus;
 
+/*
+	Owns IE, IF and IME. Components raise interrupts here directly instead of
+	doing a read-modify-write of IF through the bus, mmio only copies the values
+	into the io view when the cpu reads them.
+
+	pending is recomputed whenever one of the registers changes, so the cpu
+	checks a single flag after each instruction instead of the registers
+*/
+struct InterruptController {
+	InterruptController();
+	void reset();
+	void request(u8 interrupt);
+	void acknowledge(u16 mask); //cpu writes of 1 bits clear IF
+	void writeIE(u16 value);
+	void writeIME(u32 value);
+	inline void update() { pending = (ie & irqFlag) != 0; }
+
+	u16 ie;
+	u16 irqFlag;
+	u32 ime;
+	bool pending; //ie & if != 0, wakes the cpu from halt even with IME clear
+};
+
 void requestInterrupt(MemoryBus *mbus, u8 interrupt);
\ No newline at end of file
@@ -61,9 +61,7 @@ void TimerController::handleTimers()
 
 void TimerController::requestInterrupt(u16 interrupt)
 {
-	u16 irq_flag = mbus->mmio.readIF();
-	irq_flag = setBit(irq_flag, interrupt);
-	mbus->mmio.writeIF(irq_flag);
+	mbus->mmio.interrupts.request(interrupt);
 }
 
 void TimerController::setControl(eTimer timer, u16 value)
@@ -1,3 +1,4 @@
+#include "../Utils/Log.h" //before Arm.h, its flag macros break the std headers
 #include "Arm.h"
 #include "../Memory/MemoryBus.h"
 
@@ -49,17 +50,16 @@ u8 Arm::clock()
 
 void Arm::handleInterrupts()
 {
-	u16 ie = mbus->mmio.readIE();
-	u16 irq_flag = mbus->mmio.readIF();
+	const InterruptController& irq = mbus->mmio.interrupts;
 
 	//Cpu is paused as long as ie & if = 0
-	if((ie & irq_flag) != 0x0){
+	if (irq.pending) {
 		if (halted) halted = false;
 	}
 
 	//There is an interrupt to be serviced
-	if (ie & irq_flag) {
-		u8 ime = mbus->mmio.readIME();
+	if (irq.pending) {
+		u8 ime = irq.ime;
 		u8 interrupts = getFlag(I);
 
 		//If irqs are disabled or IME is not set, return (irq should not be serviced)
@@ -586,6 +586,9 @@ void Arm::writeU8(u32 address, u8 value)
 {
 	addCyclesFromAccess(address, U8);
 	if (address >= IO_START_ADDR && address <= IO_END_ADDR) {
+		//Io skips the bus, so watchpoints are checked here
+		if (mbus->watchpoints.armed)
+			mbus->watchpoints.onWrite(address, 1, value);
 		mbus->mmio.writeU8(address, value);
 	}
 	else
@@ -596,6 +599,8 @@ void Arm::writeU16(u32 address, u16 value)
 {
 	addCyclesFromAccess(address, U16);
 	if (address >= IO_START_ADDR && address <= IO_END_ADDR) {
+		if (mbus->watchpoints.armed)
+			mbus->watchpoints.onWrite(address, 2, value);
 		mbus->mmio.writeU16(address, value);
 	}
 	else
@@ -606,6 +611,8 @@ void Arm::writeU32(u32 address, u32 value)
 {
 	addCyclesFromAccess(address, U32);
 	if (address >= IO_START_ADDR && address <= IO_END_ADDR) {
+		if (mbus->watchpoints.armed)
+			mbus->watchpoints.onWrite(address, 4, value);
 		mbus->mmio.writeU32(address, value);
 	}
 	else
@@ -616,6 +623,8 @@ u8 Arm::readU8(u32 address)
 {
 	addCyclesFromAccess(address, U8);
 	if (address >= IO_START_ADDR && address <= IO_END_ADDR) {
+		if (mbus->watchpoints.armed)
+			mbus->watchpoints.onRead(address, 1);
 		return mbus->mmio.readU8(address);
 	}
 	return mbus->readU8(address);
@@ -625,6 +634,8 @@ u16 Arm::readU16(u32 address)
 {
 	addCyclesFromAccess(address, U16);
 	if (address >= IO_START_ADDR && address <= IO_END_ADDR) {
+		if (mbus->watchpoints.armed)
+			mbus->watchpoints.onRead(address, 2);
 		return mbus->mmio.readU16(address);
 	}
 	return mbus->readU16(address);
@@ -638,6 +649,8 @@ u32 Arm::readU32(u32 address)
 	//	printf("PC: 0x%08X\n", R15);
 	//}
 	if (address >= IO_START_ADDR && address <= IO_END_ADDR) {
+		if (mbus->watchpoints.armed)
+			mbus->watchpoints.onRead(address, 4);
 		return mbus->mmio.readU32(address);
 	}
 	return mbus->readU32(address);
@@ -957,7 +970,7 @@ u8 Arm::executeDataProcessing(ArmInstruction& ins, bool flags, bool immediate)
 	u8 lo_bits = (ins.encoding >> 4) & 0xF;
 	//Arithmetic instruction extension space
 	if (hi_bits == 0x0 && lo_bits == 0b1001) {
-		printf("arithmetic instruction set extension\n");
+		LOG_WARN(LogCategory::Cpu, "arithmetic instruction set extension 0x%08X at PC: 0x%08X", ins.encoding, R15 - 8);
 	}
 	
 	RegisterID rd = ins.rd();
@@ -1024,8 +1037,8 @@ u8 Arm::executeDataProcessingRegShift(ArmInstruction& ins)
 u8 Arm::handleUndefinedIns(ArmInstruction& ins)
 {
 	u16 lutIndex = ins.instruction();
-	printf("LUT Index: %d ", lutIndex);
-	printf("ARM undefined or unimplemented instruction 0x%08X at PC: 0x%08X\n", ins.encoding, R15 - 8);
+	LOG_ERROR(LogCategory::Cpu, "ARM undefined or unimplemented instruction 0x%08X at PC: 0x%08X (LUT index %d)",
+		ins.encoding, R15 - 8, lutIndex);
 
 	return 0;
 }
@@ -1797,8 +1810,8 @@ u8 Arm::executeThumbMisc(ThumbInstruction& ins)
 u8 Arm::handleUndefinedThumbIns(ThumbInstruction& ins)
 {
 	u8 lutIndex = ins.instruction();
-	printf("LUT Index: %d ", lutIndex);
-	printf("THUMB undefined or unimplemented instruction 0x%04X at PC: 0x%08X\n", ins.encoding, R15 - 8);
+	LOG_ERROR(LogCategory::Cpu, "THUMB undefined or unimplemented instruction 0x%04X at PC: 0x%08X (LUT index %d)",
+		ins.encoding, R15 - 8, lutIndex);
 
 	return 1;
 }
@@ -370,10 +370,11 @@ private:
 	u8 thumbOpPUSH(ThumbInstruction& ins);
 	u8 thumbOpPOP(ThumbInstruction& ins);
 
-	void pushIntoRingBuffer(u32 opcode);
-
 
 public:
+	//Comparer feeds the instructions it checked, printed on a divergence
+	void pushIntoRingBuffer(u32 opcode);
+
 	State state;
 	ProcessorMode mode;
 	/*
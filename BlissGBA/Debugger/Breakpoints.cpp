@@ -0,0 +1,162 @@
+#include "Breakpoints.h"
+#include <algorithm>
+#include <cstring>
+
+void PageBitmap::set(u32 start, u32 length)
+{
+	u32 first = (start & BREAK_ADDRESS_MASK) >> BREAK_PAGE_SHIFT;
+	u32 last = ((start + std::max(length, 1u) - 1) & BREAK_ADDRESS_MASK) >> BREAK_PAGE_SHIFT;
+	//A range wrapping past the end of the bus marks through the last page
+	if (last < first) last = BREAK_PAGES - 1;
+
+	for (u32 page = first; page <= last; page++)
+		bits[page >> 6] |= (u64)1 << (page & 63);
+}
+
+void PageBitmap::clear()
+{
+	memset(bits, 0, sizeof(bits));
+}
+
+Breakpoints::Breakpoints()
+{
+	pages.clear();
+	ignoreAddress = NO_BREAK_ADDRESS;
+	armed = false;
+}
+
+void Breakpoints::add(u32 address, bool temporary)
+{
+	for (Breakpoint& bp : list) {
+		if (bp.address == address) {
+			//A user breakpoint stays when "run until" lands on it
+			bp.temporary = bp.temporary && temporary;
+			return;
+		}
+	}
+
+	list.push_back({ address, temporary });
+	rebuildPages();
+}
+
+void Breakpoints::remove(u32 address)
+{
+	list.erase(std::remove_if(list.begin(), list.end(),
+		[address](const Breakpoint& bp) { return bp.address == address; }), list.end());
+	if (ignoreAddress == address)
+		ignoreAddress = NO_BREAK_ADDRESS;
+	rebuildPages();
+}
+
+void Breakpoints::clear()
+{
+	list.clear();
+	ignoreAddress = NO_BREAK_ADDRESS;
+	rebuildPages();
+}
+
+void Breakpoints::resume(u32 address)
+{
+	//Only a breakpoint sitting at address is skipped, one added there later still stops
+	ignoreAddress = NO_BREAK_ADDRESS;
+	for (const Breakpoint& bp : list) {
+		if (bp.address == address)
+			ignoreAddress = address;
+	}
+}
+
+bool Breakpoints::hit(u32 pc)
+{
+	//Only pcs inside a page holding a breakpoint get here
+	for (u32 i = 0; i < list.size(); i++) {
+		if (list[i].address != pc)
+			continue;
+
+		if (pc == ignoreAddress) {
+			ignoreAddress = NO_BREAK_ADDRESS;
+			return false;
+		}
+
+		if (list[i].temporary) {
+			list.erase(list.begin() + i);
+			rebuildPages();
+		}
+		return true;
+	}
+	return false;
+}
+
+void Breakpoints::rebuildPages()
+{
+	pages.clear();
+	for (const Breakpoint& bp : list)
+		pages.set(bp.address, 1);
+	armed = !list.empty();
+}
+
+Watchpoints::Watchpoints()
+{
+	readPages.clear();
+	writePages.clear();
+	armed = false;
+	triggered = false;
+	hitAddress = 0;
+	hitValue = 0;
+	hitSize = 0;
+	hitType = WatchType::Read;
+}
+
+void Watchpoints::add(u32 address, u32 length, WatchType type)
+{
+	list.push_back({ address, std::max(length, 1u), type });
+	rebuildPages();
+}
+
+void Watchpoints::remove(u32 index)
+{
+	if (index < list.size()) {
+		list.erase(list.begin() + index);
+		rebuildPages();
+	}
+}
+
+void Watchpoints::clear()
+{
+	list.clear();
+	triggered = false;
+	rebuildPages();
+}
+
+void Watchpoints::check(u32 address, u8 size, WatchType type, u32 value)
+{
+	for (const Watchpoint& wp : list) {
+		if (((u8)wp.type & (u8)type) == 0)
+			continue;
+
+		//Overlap of [address, address + size) with the watched range
+		if (address < wp.address + wp.length && wp.address < address + size) {
+			//Keep the first hit of the instruction
+			if (!triggered) {
+				triggered = true;
+				hitAddress = address;
+				hitValue = value;
+				hitSize = size;
+				hitType = type;
+			}
+			return;
+		}
+	}
+}
+
+void Watchpoints::rebuildPages()
+{
+	readPages.clear();
+	writePages.clear();
+	for (const Watchpoint& wp : list) {
+		if ((u8)wp.type & (u8)WatchType::Read)
+			readPages.set(wp.address, wp.length);
+		if ((u8)wp.type & (u8)WatchType::Write)
+			writePages.set(wp.address, wp.length);
+	}
+	armed = !list.empty();
+}
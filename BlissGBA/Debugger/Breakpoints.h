@@ -0,0 +1,104 @@
+#pragma once
+#include "../Utils/Utils.h"
+#include <vector>
+
+#define BREAK_PAGE_SHIFT 12 //4KB pages
+#define BREAK_PAGES (0x10000000 >> BREAK_PAGE_SHIFT) //upper 4 bits of the address bus are unused
+#define BREAK_ADDRESS_MASK 0x0FFFFFFF
+#define NO_BREAK_ADDRESS 0xFFFFFFFF
+
+/*
+	One bit per 4KB page of the address space, set while any breakpoint or
+	watchpoint lies in the page. Tested before the exact lists are looked at
+*/
+struct PageBitmap {
+	inline bool test(u32 address) const
+	{
+		u32 page = (address & BREAK_ADDRESS_MASK) >> BREAK_PAGE_SHIFT;
+		return (bits[page >> 6] >> (page & 63)) & 0x1;
+	}
+	void set(u32 start, u32 length);
+	void clear();
+
+	u64 bits[BREAK_PAGES / 64];
+};
+
+struct Breakpoint {
+	u32 address;
+	bool temporary; //removed once hit, "run until address" uses these
+};
+
+/*
+	Execute breakpoints. The emulator loop only calls check() while armed,
+	a pc in a page without breakpoints costs a single bit test
+*/
+struct Breakpoints {
+	Breakpoints();
+	void add(u32 address, bool temporary = false);
+	void remove(u32 address);
+	void clear();
+	//Lets the instruction at address run once, so resuming from a
+	//breakpoint doesn't stop on it straight away
+	void resume(u32 address);
+
+	inline bool check(u32 pc)
+	{
+		return pages.test(pc) && hit(pc);
+	}
+	bool hit(u32 pc);
+	void rebuildPages();
+
+	std::vector<Breakpoint> list;
+	PageBitmap pages;
+	u32 ignoreAddress;
+	bool armed;
+};
+
+enum class WatchType : u8 {
+	Read = 1,
+	Write = 2,
+	ReadWrite = 3
+};
+
+struct Watchpoint {
+	u32 address;
+	u32 length;
+	WatchType type;
+};
+
+/*
+	Read/write watchpoints, checked by the memory bus on every access while
+	armed. This covers cpu fetches and dma as well, they go through the bus too.
+	A hit is only recorded here, the emulator loop stops after the instruction
+*/
+struct Watchpoints {
+	Watchpoints();
+	void add(u32 address, u32 length, WatchType type);
+	void remove(u32 index);
+	void clear();
+
+	inline void onRead(u32 address, u8 size)
+	{
+		if (readPages.test(address))
+			check(address, size, WatchType::Read, 0);
+	}
+	inline void onWrite(u32 address, u8 size, u32 value)
+	{
+		if (writePages.test(address))
+			check(address, size, WatchType::Write, value);
+	}
+	void check(u32 address, u8 size, WatchType type, u32 value);
+	void rebuildPages();
+
+	std::vector<Watchpoint> list;
+	PageBitmap readPages;
+	PageBitmap writePages;
+	bool armed;
+
+	//Last hit, valid while triggered is set
+	bool triggered;
+	u32 hitAddress;
+	u32 hitValue;
+	u8 hitSize;
+	WatchType hitType;
+};
@@ -10,6 +10,15 @@ MemoryEditor DebugUI::ioEditor;
 MemoryEditor DebugUI::obwramEditor;
 MemoryEditor DebugUI::ocwramEditor;
 MemoryEditor DebugUI::gamepakMemory;
+bool DebugUI::displayMemoryEdited = false;
+
+void DebugUI::writeDisplayMemory(ImU8* data, size_t offset, ImU8 value)
+{
+    //Byte edits skip the bus (it repeats bytes in vram/pram and drops them in oam),
+    //the ppu copies display memory again afterwards
+    data[offset] = value;
+    displayMemoryEdited = true;
+}
 
 DebugUI::DebugUI(sf::RenderWindow *window, Emulator *emu)
 	:window(window), emu(emu), logger(emu->cpu), cmper(emu->cpu)
@@ -18,7 +27,6 @@ DebugUI::DebugUI(sf::RenderWindow *window, Emulator *emu)
     cpu = &emu->cpu;
     ppu = &emu->ppu;
 
-    runToAddr = false;
     runToOpcode = false;
     showRegisterWindow = true;
     showBankedRegisters = true;
@@ -36,7 +44,9 @@ DebugUI::DebugUI(sf::RenderWindow *window, Emulator *emu)
     showPipeline = true;
     showDisplay = true;
     vsync = false;
+    colorCorrection = false;
     showLoggerSetup = false;
+    showBreakpoints = false;
     compareAgainstFile = false;
 
     stepCountStr = "1";
@@ -46,6 +56,14 @@ DebugUI::DebugUI(sf::RenderWindow *window, Emulator *emu)
     showKeys[0] = false; showKeys[1] = false;
     memset(addressBufferText, 0, sizeof(addressBufferText));
     memset(opcodeBufferText, 0, sizeof(opcodeBufferText));
+    memset(breakAddressText, 0, sizeof(breakAddressText));
+    memset(watchAddressText, 0, sizeof(watchAddressText));
+    watchLength = 1;
+    watchType = 1; //write
+
+    palRamEditor.WriteFn = &DebugUI::writeDisplayMemory;
+    vramEditor.WriteFn = &DebugUI::writeDisplayMemory;
+    oamEditor.WriteFn = &DebugUI::writeDisplayMemory;
 }
 
 void DebugUI::render()
@@ -58,6 +76,7 @@ void DebugUI::render()
     renderPipeline();
     renderEmuButtons();
     renderLogSetup();
+    renderBreakpoints();
     renderDisplay();
 
     if (showBiosMemory) {
@@ -72,8 +91,13 @@ void DebugUI::render()
     if (showOAM) {
         oamEditor.DrawWindow("OAM", mbus->getOAM(), OAM_SIZE);
     }
+    if (displayMemoryEdited) {
+        //The ppu draws from its own copy, it only sees writes made through the bus
+        ppu->resyncDisplayMemory();
+        displayMemoryEdited = false;
+    }
     if (showIO) {
-        ioEditor.DrawWindow("IO Registers", mbus->getIO(), IO_SIZE);
+        renderIoRegisters();
     }
     if (showOBWRAM) {
         obwramEditor.DrawWindow("OBWRAM", mbus->getOBWRAM(), OB_WRAM_SIZE);
@@ -83,11 +107,34 @@ void DebugUI::render()
     }
     if (showGamePakMemory) {
         if (mbus->getGamePakMemory() != nullptr) {
-            gamepakMemory.DrawWindow("GamePak Memory", mbus->getGamePakMemory(), GAMEPAK_WS_SIZE);
+            //The rom is mapped read only
+            gamepakMemory.ReadOnly = true;
+            gamepakMemory.DrawWindow("GamePak Memory", (void*)mbus->getGamePakMemory(), mbus->getGamePakSize());
         }
     }
 }
 
+void DebugUI::renderIoRegisters()
+{
+    //IE/IF/IME, DISPSTAT/VCOUNT and the timer counters live in their components,
+    //show what their read handlers return instead of the stored io bytes
+    Mmio& mmio = mbus->mmio;
+    for (u32 offset = 0; offset < IO_SIZE; offset++) {
+        const IoRegister& reg = mmio.registers[offset];
+        u32 base = offset & ~(reg.width - 1);
+        ioView[offset] = (u8)(mmio.readRegister(base) >> ((offset - base) * 8));
+    }
+    std::copy(ioView, ioView + IO_SIZE, ioShown);
+
+    ioEditor.DrawWindow("IO Registers", ioView, IO_SIZE);
+
+    //Edits act like cpu writes, the register's write handler runs
+    for (u32 offset = 0; offset < IO_SIZE; offset++) {
+        if (ioView[offset] != ioShown[offset])
+            mmio.writeU8(IO_START_ADDR + offset, ioView[offset]);
+    }
+}
+
 void DebugUI::renderGeneralState()
 {
     if (showRegisterWindow) {
@@ -354,17 +401,22 @@ void DebugUI::renderMenuBar()
             }
             ImGui::MenuItem("Logging", nullptr, &showLoggerSetup);
             if (ImGui::MenuItem("Compare against file", nullptr, &compareAgainstFile)) {
-                auto file = tinyfd_openFileDialog(
-                    "BIN",
-                    "",
-                    5,
-                    fileTypes,
-                    "BIN",
-                    0);
-
-                if (file != nullptr) {
-                    std::string path = std::filesystem::path(file).string();
-                    cmper.openExistingFile(path);
+                if (!compareAgainstFile) {
+                    cmper.closeFile();
+                }
+                else {
+                    auto file = tinyfd_openFileDialog(
+                        "BIN",
+                        "",
+                        5,
+                        fileTypes,
+                        "BIN",
+                        0);
+
+                    if (file != nullptr) {
+                        std::string path = std::filesystem::path(file).string();
+                        cmper.openExistingFile(path);
+                    }
                 }
             }
               
@@ -390,17 +442,52 @@ void DebugUI::renderMenuBar()
             ImGui::MenuItem("Show GamePak memory", nullptr, &showGamePakMemory);
             ImGui::MenuItem("Show IO registers", nullptr, &showIO);
             ImGui::MenuItem("Show Interrupts", nullptr, &showInterruptsWindow);
+            ImGui::MenuItem("Breakpoints", nullptr, &showBreakpoints);
             ImGui::MenuItem("Show Palette RAM", nullptr, &showPALRAM);
             ImGui::MenuItem("Show VRAM", nullptr, &showVRAM);
             ImGui::MenuItem("Show OAM", nullptr, &showOAM);
             ImGui::MenuItem("Show OB WRAM", nullptr, &showOBWRAM);
             ImGui::MenuItem("Show OC WRAM", nullptr, &showOCWRAM);
+            ImGui::Separator();
+            //Results go to the console
+            if (ImGui::MenuItem("Benchmark scanline kernels"))
+                runScanlineKernelBenchmark();
             ImGui::EndMenu();
         }
 
         if (ImGui::BeginMenu("Configuration")) {
             if (ImGui::MenuItem("Vsync", nullptr, &vsync))
                 window->setFramerateLimit(vsync ? 60 : 0);
+            if (ImGui::MenuItem("LCD Color Correction", nullptr, &colorCorrection)) {
+                ppu->sync();
+                ColorLut::build(colorCorrection);
+                ppu->palette.invalidateAll();
+                ppu->invalidateLines();
+            }
+            if (ImGui::MenuItem("Deterministic RTC", nullptr, mbus->pak.rtc.deterministic))
+                mbus->pak.rtc.setDeterministic(!mbus->pak.rtc.deterministic);
+            if (ImGui::BeginMenu("Log Levels")) {
+                Log& log = Log::get();
+                for (u8 c = 0; c < (u8)LogCategory::Count; c++) {
+                    if (ImGui::BeginMenu(logCategoryName((LogCategory)c))) {
+                        for (u8 l = 0; l <= (u8)LogLevel::Off; l++) {
+                            if (ImGui::MenuItem(logLevelName((LogLevel)l), nullptr, log.levels[c] == (LogLevel)l))
+                                log.setLevel((LogCategory)c, (LogLevel)l);
+                        }
+                        ImGui::EndMenu();
+                    }
+                }
+                ImGui::EndMenu();
+            }
+            if (ImGui::BeginMenu("PPU Rendering")) {
+                if (ImGui::MenuItem("Per scanline", nullptr, ppu->renderMode == PpuRenderMode::Immediate))
+                    ppu->setRenderMode(PpuRenderMode::Immediate);
+                if (ImGui::MenuItem("Catch up", nullptr, ppu->renderMode == PpuRenderMode::CatchUp))
+                    ppu->setRenderMode(PpuRenderMode::CatchUp);
+                if (ImGui::MenuItem("Worker thread", nullptr, ppu->renderMode == PpuRenderMode::Threaded))
+                    ppu->setRenderMode(PpuRenderMode::Threaded);
+                ImGui::EndMenu();
+            }
 
             ImGui::End();
         }
@@ -436,6 +523,7 @@ void DebugUI::renderCartInfo()
 
             ImGui::Text("Game Title: %s", mbus->pak.title.c_str());
             ImGui::Text("ROM Size: %s", mbus->pak.romSize.c_str());
+            ImGui::Text("ROM CRC32: %08X", mbus->pak.crc);
 
             ImGui::End();
         }
@@ -479,12 +567,7 @@ void DebugUI::renderDisplay()
     if (showDisplay) {
         if (ImGui::Begin("Display")) {
 
-            if (ppu->mode == BGMode::ZERO)
-                ImGui::Image(ppu->mode0.frame);
-            else if (ppu->mode == BGMode::THREE)
-                ImGui::Image(ppu->mode3.frame);
-            else if (ppu->mode == BGMode::FOUR)
-                ImGui::Image(ppu->mode4.frame);
+            ImGui::Image(ppu->screen.sprite);
 
             ImGui::End();
         }
@@ -500,7 +583,7 @@ void DebugUI::renderEmuButtons()
     ImGui::PopStyleColor();
 
     if (ImGui::Button("Run")) {
-        *running = true;
+        resume();
     }
     ImGui::SameLine();
     if (ImGui::Button("Step")) {
@@ -563,8 +646,8 @@ void DebugUI::renderEmuButtons()
         ss >> addressToRunTo;
 
         printf("Running to address: 0x%08X\n", addressToRunTo);
-        *running = true;
-        runToAddr = true;
+        emu->breakpoints.add(addressToRunTo, true);
+        resume();
     }
 
     ImGui::NewLine();
@@ -585,7 +668,7 @@ void DebugUI::renderEmuButtons()
             ss >> armOpcodeToRunTo;
 
             printf("Running to opcode: 0x%08X\n", armOpcodeToRunTo);
-            *running = true;
+            resume();
             runToOpcode = true;
         }
         else {
@@ -594,7 +677,7 @@ void DebugUI::renderEmuButtons()
             ss >> thumbOpcodeToRunTo;
 
             printf("Running to opcode: 0x%04X\n", thumbOpcodeToRunTo);
-            *running = true;
+            resume();
             runToOpcode = true;
         }
     }
@@ -621,26 +704,117 @@ void DebugUI::renderLogSetup()
     }
 }
 
-void DebugUI::update()
+void DebugUI::renderBreakpoints()
 {
-    //Running emulation until specific address is hit
-    if (runToAddr && *running) {
-        if (cpu->getState() == State::ARM) {
-            if ((emu->cpu.R15 - 8) == addressToRunTo) {
-                printf("Hit address in arm mode!\n");
-                *running = false;
-                runToAddr = false;
-            }
+    static const char* watchTypes[] = { "Read", "Write", "Read/Write" };
+
+    if (showBreakpoints) {
+        ImGui::Begin("Breakpoints");
+
+        ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(ImColor(255, 242, 0, 255)));
+        ImGui::Text("Execute");
+        ImGui::PopStyleColor();
+
+        ImGui::InputText("##BreakAddress", breakAddressText, sizeof(breakAddressText));
+        ImGui::SameLine();
+        if (ImGui::Button("Add##Breakpoint")) {
+            emu->breakpoints.add(strtoul(breakAddressText, nullptr, 16));
         }
-        else {
-            if ((emu->cpu.R15 - 4) == addressToRunTo) {
-                printf("Hit address in thumb mode!\n");
-                *running = false;
-                runToAddr = false;
-            }
+
+        s32 removeBreakpoint = -1;
+        for (u32 i = 0; i < emu->breakpoints.list.size(); i++) {
+            Breakpoint& bp = emu->breakpoints.list[i];
+            ImGui::PushID(i);
+            ImGui::Text("0x%08X%s", bp.address, bp.temporary ? " (run until)" : "");
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Remove"))
+                removeBreakpoint = i;
+            ImGui::PopID();
         }
+        if (removeBreakpoint != -1)
+            emu->breakpoints.remove(emu->breakpoints.list[removeBreakpoint].address);
+
+        ImGui::NewLine();
+
+        ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(ImColor(255, 242, 0, 255)));
+        ImGui::Text("Watch");
+        ImGui::PopStyleColor();
+
+        ImGui::InputText("Address##Watch", watchAddressText, sizeof(watchAddressText));
+        ImGui::InputInt("Length##Watch", &watchLength);
+        ImGui::Combo("Type##Watch", &watchType, watchTypes, IM_ARRAYSIZE(watchTypes));
+        if (ImGui::Button("Add##Watchpoint")) {
+            watchLength = std::max(watchLength, 1);
+            mbus->watchpoints.add(strtoul(watchAddressText, nullptr, 16), watchLength,
+                (WatchType)(watchType + 1));
+        }
+
+        s32 removeWatchpoint = -1;
+        for (u32 i = 0; i < mbus->watchpoints.list.size(); i++) {
+            Watchpoint& wp = mbus->watchpoints.list[i];
+            ImGui::PushID(0x10000 + i);
+            ImGui::Text("0x%08X - 0x%08X %s", wp.address, wp.address + wp.length - 1,
+                watchTypes[(u8)wp.type - 1]);
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Remove"))
+                removeWatchpoint = i;
+            ImGui::PopID();
+        }
+        if (removeWatchpoint != -1)
+            mbus->watchpoints.remove(removeWatchpoint);
+
+        ImGui::End();
     }
-    
+}
+
+u32 DebugUI::executingAddress()
+{
+    return (cpu->getState() == State::ARM) ? cpu->R15 - 8 : cpu->R15 - 4;
+}
+
+void DebugUI::resume()
+{
+    //Don't stop again on the breakpoint we're sitting on
+    emu->breakpoints.resume(executingAddress());
+    mbus->watchpoints.triggered = false;
+    *running = true;
+}
+
+void DebugUI::breakpointHit(u32 address)
+{
+    printf("Hit breakpoint at 0x%08X in %s mode!\n", address,
+        (cpu->getState() == State::ARM) ? "arm" : "thumb");
+    *running = false;
+
+    //Bring the debugger up if the game was running full screen
+    if (!emu->debuggerRunning) {
+        *showDebugger = true;
+        emu->debuggerRunning = true;
+        onDebugUIToggle();
+    }
+}
+
+void DebugUI::watchpointHit()
+{
+    Watchpoints& wp = mbus->watchpoints;
+    if (wp.hitType == WatchType::Write)
+        printf("Hit watchpoint, U%d write of 0x%08X to 0x%08X (stopped at 0x%08X)\n",
+            wp.hitSize * 8, wp.hitValue, wp.hitAddress, executingAddress());
+    else
+        printf("Hit watchpoint, U%d read of 0x%08X (stopped at 0x%08X)\n",
+            wp.hitSize * 8, wp.hitAddress, executingAddress());
+    wp.triggered = false;
+    *running = false;
+
+    if (!emu->debuggerRunning) {
+        *showDebugger = true;
+        emu->debuggerRunning = true;
+        onDebugUIToggle();
+    }
+}
+
+void DebugUI::update()
+{
     if (runToOpcode && *running) {
 
         if (cpu->getState() == State::ARM) {
@@ -663,7 +837,7 @@ void DebugUI::update()
         logger.writeFile();
     }
 
-    if (compareAgainstFile && *running) {
+    if (compareAgainstFile && cmper.isActive() && *running) {
         cmper.compareAgainstFile();
     }
 }
@@ -8,9 +8,10 @@
 #include <filesystem>
 #include "tinyfiledialogs.h"
 #include "../Memory/MemoryBus.h"
-#include "../Cpu/Arm.h"
-#include "../Ppu/Ppu.h"
+#include "../Ppu/Ppu.h" //before Arm.h, its flag macros break the std headers Ppu.h pulls in
+#include "../Utils/Log.h"
 #include "Logger.h"
+#include "../Cpu/Arm.h"
 
 class Emulator;
 class MemoryBus;
@@ -29,7 +30,18 @@ struct DebugUI {
 	void renderDisplay();
 	void renderEmuButtons();
 	void renderLogSetup();
+	void renderBreakpoints();
+	void renderIoRegisters();
 	void update();
+	//Per instruction work apart from breakpoints, which the emulator checks itself
+	inline bool needsUpdate()
+	{
+		return runToOpcode || logger.isActive() || (compareAgainstFile && cmper.isActive());
+	}
+	void resume();
+	void breakpointHit(u32 address);
+	void watchpointHit();
+	u32 executingAddress();
 	void handleButtonPresses();
 	void handleEvents(sf::Event& ev);
 
@@ -43,6 +55,8 @@ struct DebugUI {
 	static MemoryEditor obwramEditor;
 	static MemoryEditor ocwramEditor;
 	static MemoryEditor gamepakMemory;
+	static bool displayMemoryEdited;
+	static void writeDisplayMemory(ImU8* data, size_t offset, ImU8 value);
 
 	Logger logger;
 	Comparer cmper;
@@ -51,7 +65,6 @@ struct DebugUI {
 
 	bool* running = nullptr;
 	bool *showDebugger = nullptr;
-	bool runToAddr;
 	bool runToOpcode;
 	bool showRegisterWindow;
 	bool showBankedRegisters;
@@ -69,7 +82,9 @@ struct DebugUI {
 	bool showPipeline;
 	bool showDisplay;
 	bool vsync;
+	bool colorCorrection;
 	bool showLoggerSetup;
+	bool showBreakpoints;
 	bool showKeys[2];
 	
 
@@ -78,6 +93,13 @@ struct DebugUI {
 	u32 armOpcodeToRunTo;
 	u16 thumbOpcodeToRunTo;
 	char opcodeBufferText[9];
+	//Io as the cpu would read it, a copy so the stored io bytes aren't overwritten
+	u8 ioView[IO_SIZE];
+	u8 ioShown[IO_SIZE];
+	char breakAddressText[11];
+	char watchAddressText[11];
+	int watchLength;
+	int watchType;
 	std::string stepCountStr;
 	u32 stepCount;
 
@@ -1,17 +1,43 @@
 #include "Logger.h"
+#include "../Utils/Compress.h"
+#include <cstring>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <xmmintrin.h>
+#define PREFETCH(address) _mm_prefetch((const char*)(address), _MM_HINT_T0)
+#else
+#define PREFETCH(address)
+#endif
 #include "../Cpu/Arm.h"
 
+void captureTraceState(Arm& cpu, TraceState& state)
+{
+	state.thumb = cpu.getState() != State::ARM;
+	state.opcode = state.thumb ? cpu.currentExecutingThumbOpcode : cpu.currentExecutingArmOpcode;
+	for (int i = 0; i < NUM_REGISTERS; i++)
+		state.fields[i] = cpu.registers[i].value;
+	state.fields[TRACE_FIELD_R13] = cpu.SP;
+	state.fields[TRACE_FIELD_R14] = cpu.LR;
+	state.fields[TRACE_FIELD_R15] = cpu.R15;
+	state.fields[TRACE_FIELD_CPSR] = cpu.CPSR;
+	state.fields[TRACE_FIELD_SPSR] = cpu.SPSR;
+}
+
 Logger::Logger(Arm& cpu)
 	:cpu(cpu)
 {
 
 }
 
+Logger::~Logger()
+{
+	closeFile();
+}
+
 void Logger::createAndOpenFile(const std::string& fileName)
 {
 	if (!file.is_open()) {
-		std::string abs_path = "Debugger/logs/" + fileName + ".txt";
-		file.open(abs_path, std::ios::out | std::ios::app);
+		std::string abs_path = "Debugger/logs/" + fileName + ".btrc";
+		file.open(abs_path, std::ios::out | std::ios::binary | std::ios::trunc);
 		if (!file.is_open()) {
 			std::cerr << "File <" << fileName << "> failed to open\n";
 			return;
@@ -19,51 +45,90 @@ void Logger::createAndOpenFile(const std::string& fileName)
 		else {
 			std::cout << "File <" << fileName << "> successfully created and opened for writing\n";
 		}
+
+		u32 header[2] = { TRACE_MAGIC, TRACE_VERSION };
+		file.write((const char*)header, sizeof(header));
+
+		block = new TraceBlock;
+		block->size = 0;
+		blocks = new SpscRing<TraceBlock, TRACE_BLOCKS>();
+		first = true;
+		active = true;
+		writerRunning = true;
+		writer = std::thread(&Logger::writerLoop, this);
 	}
 }
 
 void Logger::writeFile()
 {
-	if (file.is_open()) {
-		if (cpu.getState() == State::ARM) {
-			u32 opcode = cpu.currentExecutingArmOpcode;
-			file << "Opcode: " + intToHexString(opcode) + " ";
-		}
-		else {
-			u16 opcode = cpu.currentExecutingThumbOpcode;
-			file << "Opcode: " + intToHexString(opcode) + " ";
+	if (!active)
+		return;
+
+	TraceState next;
+	captureTraceState(cpu, next);
+
+	block->size += encodeTraceRecord(block->data + block->size, last, next, first);
+	first = false;
+
+	if (block->size + TRACE_MAX_RECORD > TRACE_BLOCK_SIZE)
+		submitBlock();
+}
+
+void Logger::submitBlock()
+{
+	if (block->size == 0)
+		return;
+
+	//Only waits when the disk can't keep up
+	while (!blocks->push(*block))
+		std::this_thread::yield();
+	block->size = 0;
+}
+
+void Logger::writerLoop()
+{
+	std::vector<u8> compressed(TRACE_BLOCK_SIZE);
+	while (true) {
+		TraceBlock* next = blocks->front();
+		if (next == nullptr) {
+			if (!writerRunning.load(std::memory_order_acquire) && blocks->empty())
+				break;
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			continue;
 		}
 
-		for (int i = 0; i < NUM_REGISTERS; i++) {
-			file << "R" + std::to_string(i) + ": "
-				+ intToHexString(cpu.registers[i].value) + " ";
+		u32 stored = compressBlock(next->data, next->size, compressed.data(), next->size - 1);
+		const u8* data = compressed.data();
+		if (stored == 0) {
+			stored = next->size;
+			data = next->data;
 		}
-		file << "R13: " + intToHexString(cpu.SP) + " ";
-		file << "R14: " + intToHexString(cpu.LR) + " ";
-		file << "R15: " + intToHexString(cpu.R15) + " ";
-		file << "CPSR: " + intToHexString(cpu.CPSR) + " ";
-		file << "SPSR: " + intToHexString(cpu.SPSR) + "\n";
+
+		u32 sizes[2] = { next->size, stored };
+		file.write((const char*)sizes, sizeof(sizes));
+		file.write((const char*)data, stored);
+		blocks->pop();
 	}
+	file.flush();
 }
 
 void Logger::closeFile()
 {
-	if (file.is_open()) {
-		file.close();
+	if (active) {
+		submitBlock();
+		writerRunning = false;
+		writer.join();
+		active = false;
+
+		delete block;
+		delete blocks;
+		block = nullptr;
+		blocks = nullptr;
 	}
-}
 
-std::string Logger::intToHexString(u32 value)
-{
-	std::stringstream ss;
-	ss << std::hex << value;
-	std::string lower = ss.str();
-	for (int i = 0; i < lower.length(); i++) {
-		lower[i] = toupper(lower[i]);
+	if (file.is_open()) {
+		file.close();
 	}
-	std::string res = "0x" + lower;
-
-	return res;
 }
 
 Comparer::Comparer(Arm& cpu)
@@ -74,156 +139,167 @@ Comparer::Comparer(Arm& cpu)
 
 void Comparer::openExistingFile(const std::string& fileName)
 {
-	if (!file.is_open()) {
-		file.open(fileName, std::ios::binary);
-		if (!file.is_open()) {
-			std::cerr << "File <" << fileName << "> failed to open\n";
-			return;
-		}
-		else {
-			std::cout << "File <" << fileName << "> successfully opened\n";
+	closeFile();
+	if (!file.open(fileName, true)) {
+		std::cerr << "File <" << fileName << "> failed to open\n";
+		return;
+	}
+	std::cout << "File <" << fileName << "> successfully opened\n";
+
+	u32 header[2] = { 0, 0 };
+	if (file.size >= sizeof(header))
+		memcpy(header, file.data, sizeof(header));
+
+	instructionCounter = 0;
+	divergences = 0;
+	if (header[0] == TRACE_MAGIC && header[1] == TRACE_VERSION) {
+		format = TraceFormat::Binary;
+		position = sizeof(header);
+		blockSize = 0;
+		blockPosition = 0;
+		reference = {};
+	}
+	else {
+		format = TraceFormat::Raw;
+		////Skip first 2 instructions in sky's log
+		position = COMPARE_RAW_SKIP * sizeof(ExpectedState);
+		instructionCounter += COMPARE_RAW_SKIP;
+	}
+	active = true;
+}
 
-			file.seekg(0, std::ios::end);
-			u32 file_length = file.tellg();
-			file.seekg(0, std::ios::beg);
+bool Comparer::nextBlock()
+{
+	u32 sizes[2];
+	if (position + sizeof(sizes) > file.size)
+		return false;
+	memcpy(sizes, file.data + position, sizeof(sizes));
+	position += sizeof(sizes);
+
+	u32 rawSize = sizes[0];
+	u32 storedSize = sizes[1];
+	if (rawSize > TRACE_BLOCK_SIZE || storedSize > rawSize || position + storedSize > file.size)
+		return false;
+
+	if (storedSize == rawSize) {
+		//Uncompressed blocks are read straight from the mapping
+		blockData = file.data + position;
+	}
+	else {
+		block.resize(TRACE_BLOCK_SIZE);
+		if (!decompressBlock(file.data + position, storedSize, block.data(), rawSize))
+			return false;
+		blockData = block.data();
+	}
+	position += storedSize;
+	blockSize = rawSize;
+	blockPosition = 0;
 
-			fileBuffer = new u32[file_length];
-			file.read((char*)fileBuffer, file_length);
+	if (position < file.size)
+		PREFETCH(file.data + position);
+	return true;
+}
 
-			state = reinterpret_cast<ExpectedState*>(fileBuffer);
-			////Skip first 2 instructions in sky's log
-			state += 2;
-			instructionCounter += 2;
-		}
+bool Comparer::nextExpected(TraceState& expected)
+{
+	if (format == TraceFormat::Raw) {
+		if (position + sizeof(ExpectedState) > file.size)
+			return false;
+		if (position + COMPARE_PREFETCH_DISTANCE < file.size)
+			PREFETCH(file.data + position + COMPARE_PREFETCH_DISTANCE);
+
+		ExpectedState state;
+		memcpy(&state, file.data + position, sizeof(state));
+		position += sizeof(state);
+
+		for (s32 i = 0; i < 13; i++)
+			expected.fields[i] = state.regs[i];
+		expected.fields[TRACE_FIELD_R13] = state.sp;
+		expected.fields[TRACE_FIELD_R14] = state.lr;
+		expected.fields[TRACE_FIELD_R15] = state.r15;
+		expected.fields[TRACE_FIELD_CPSR] = state.cpsr;
+		expected.fields[TRACE_FIELD_SPSR] = state.spsr;
+		return true;
 	}
+
+	if (blockPosition == blockSize && !nextBlock())
+		return false;
+	u32 length = decodeTraceRecord(blockData + blockPosition, blockSize - blockPosition, reference);
+	if (length == 0)
+		return false;
+	blockPosition += length;
+	expected = reference;
+	return true;
 }
 
 void Comparer::compareAgainstFile()
 {
-	u32 state_address;
-	if (cpu.getState() == State::ARM)
-		state_address = cpu.R15 - 8;
-	else
-		state_address = cpu.R15 - 4;
-
-	for (s32 i = 0; i < 13; i++) {
-		u32 reg = cpu.getRegister(RegisterID{ (u8)i });
-		if (reg != state->regs[i]) {
-			if (cpu.getState() == State::ARM) {
-				printf("!!!CPU State Fails To Match Log!!! at address 0x%08X\n", state_address);
-				printf("Register %d does not match\n", i);
-				printf("Our value: 0x%08X\n", cpu.getRegister(RegisterID{ (u8)i }));
-				printf("Logs value: 0x%08X\n", state->regs[i]);
-				printf("Instruction #: %d\n", instructionCounter);
-
-				printRegisterStatus();
-
-				assert(false);
-			}
-			else {
-				printf("!!!CPU State Fails To Match Log!!! at address 0x%08X\n", state_address);
-				printf("Register %d does not match\n", i);
-				printf("Our value: 0x%08X\n", cpu.getRegister(RegisterID{ (u8)i }));
-				printf("Logs value: 0x%08X\n", state->regs[i]);
-				printf("Instruction #: %d\n", instructionCounter);
-
-				printRegisterStatus();
-
-				assert(false);
-			}
-			
-		}
+	if (!active)
+		return;
+
+	TraceState expected;
+	if (!nextExpected(expected)) {
+		printf("Reference trace ended after %llu instructions, %u divergences\n",
+			(unsigned long long)instructionCounter, divergences);
+		closeFile();
+		return;
 	}
 
-	u32 r13 = cpu.getRegister(RegisterID{ R13_ID });
-	if (r13 != state->sp) {
-		printf("!!!CPU State Fails To Match Log!!! at address 0x%08X\n", state_address);
-		printf("Register 13(SP) does not match\n");
-		printf("Our value: 0x%08X\n", r13);
-		printf("Logs value: 0x%08X\n", state->sp);
-		printf("Instruction #: %d\n", instructionCounter);
-		if (cpu.getState() == State::ARM) {
-			printf("\nArm Register State:\n");
-			printRegisterStatus();
-		}
-		else {
-			printf("\nThumb Register State:\n");
-			printRegisterStatus();
-		}
-		assert(false);
-	}
-	u32 r14 = cpu.getRegister(RegisterID{ R14_ID });
-	if (r14 != state->lr) {
-		printf("!!!CPU State Fails To Match Log!!! at address 0x%08X\n", state_address);
-		printf("Register 14(LR) does not match\n");
-		printf("Our value: 0x%08X\n", r14);
-		printf("Logs value: 0x%08X\n", state->lr);
-		printf("Instruction #: %d\n", instructionCounter);
-		if (cpu.getState() == State::ARM) {
-			printf("\nArm Register State:\n");
-			printRegisterStatus();
-		}
-		else {
-			printf("\nThumb Register State:\n");
-			printRegisterStatus();
-		}
-		assert(false);
-	}
-	if (cpu.R15 != state->r15) {
-		printf("!!!CPU State Fails To Match Log!!! at address 0x%08X\n", state_address);
-		printf("Register 15(R15) does not match\n");
-		printf("Our value: 0x%08X\n", cpu.R15);
-		printf("Logs value: 0x%08X\n", state->r15);
-		printf("Instruction #: %d\n", instructionCounter);
-		if (cpu.getState() == State::ARM) {
-			printf("\nArm Register State:\n");
-			printRegisterStatus();
-		}
-		else {
-			printf("\nThumb Register State:\n");
-			printRegisterStatus();
-		}
-		assert(false);
+	//Raw logs from other emulators hold the registers of the current mode,
+	//our own traces hold exactly what the Logger captured
+	TraceState ours;
+	if (format == TraceFormat::Binary) {
+		captureTraceState(cpu, ours);
 	}
-	if (cpu.CPSR != state->cpsr) {
-		printf("!!!CPU State Fails To Match Log!!! at address 0x%08X\n", state_address);
-		printf("CPSR) does not match\n");
-		printf("Our value: 0x%08X\n", cpu.CPSR);
-		printf("Logs value: 0x%08X\n", state->cpsr);
-		printf("Instruction #: %d\n", instructionCounter);
-		if (cpu.getState() == State::ARM) {
-			printf("\nArm Register State:\n");
-			printRegisterStatus();
-		}
-		else {
-			printf("\nThumb Register State:\n");
-			printRegisterStatus();
-		}
-		assert(false);
+	else {
+		ours.thumb = cpu.getState() != State::ARM;
+		ours.opcode = ours.thumb ? cpu.currentExecutingThumbOpcode : cpu.currentExecutingArmOpcode;
+		for (s32 i = 0; i < 13; i++)
+			ours.fields[i] = cpu.getRegister(RegisterID{ (u8)i });
+		ours.fields[TRACE_FIELD_R13] = cpu.getRegister(RegisterID{ R13_ID });
+		ours.fields[TRACE_FIELD_R14] = cpu.getRegister(RegisterID{ R14_ID });
+		ours.fields[TRACE_FIELD_R15] = cpu.R15;
+		ours.fields[TRACE_FIELD_CPSR] = cpu.CPSR;
+		ours.fields[TRACE_FIELD_SPSR] = cpu.getSPSR();
+		expected.thumb = ours.thumb;
+		expected.opcode = ours.opcode;
 	}
-	u32 spsr = cpu.getSPSR();
-	if (spsr != state->spsr) {
-		printf("!!!CPU State Fails To Match Log!!! at address 0x%08X\n", state_address);
-		printf("SPSR does not match\n");
-		printf("Our value: 0x%08X\n", spsr);
-		printf("Logs value: 0x%08X\n", state->spsr);
-		printf("Instruction #: %d\n", instructionCounter);
-
-		if (cpu.getState() == State::ARM) {
-			printf("\nArm Register State:\n");
-			printRegisterStatus();
-		}
-		else {
-			printf("\nThumb Register State:\n");
-			printRegisterStatus();
+	cpu.pushIntoRingBuffer(ours.opcode);
+
+	bool match = memcmp(ours.fields, expected.fields, sizeof(ours.fields)) == 0 &&
+		ours.opcode == expected.opcode && ours.thumb == expected.thumb;
+	if (!match) {
+		reportDivergence(ours, expected);
+		if (++divergences >= COMPARE_MAX_DIVERGENCES) {
+			printf("Stopped comparing after %u divergences\n", divergences);
+			closeFile();
+			return;
 		}
-		assert(false);
 	}
+	instructionCounter += 1;
+}
 
-	
+void Comparer::reportDivergence(const TraceState& ours, const TraceState& expected)
+{
+	static const char* fieldNames[TRACE_FIELDS] = { "R0", "R1", "R2", "R3", "R4", "R5", "R6", "R7",
+		"R8", "R9", "R10", "R11", "R12", "R13(SP)", "R14(LR)", "R15", "CPSR", "SPSR" };
+
+	u32 state_address = (cpu.getState() == State::ARM) ? cpu.R15 - 8 : cpu.R15 - 4;
+	printf("!!!CPU State Fails To Match Log!!! at address 0x%08X\n", state_address);
+	printf("Divergence %u of at most %u, instruction #: %llu\n", divergences + 1,
+		COMPARE_MAX_DIVERGENCES, (unsigned long long)instructionCounter);
+
+	if (ours.thumb != expected.thumb)
+		printf("State: ours %s, log %s\n", ours.thumb ? "thumb" : "arm", expected.thumb ? "thumb" : "arm");
+	if (ours.opcode != expected.opcode)
+		printf("Opcode: ours 0x%08X, log 0x%08X\n", ours.opcode, expected.opcode);
+	for (u32 i = 0; i < TRACE_FIELDS; i++) {
+		if (ours.fields[i] != expected.fields[i])
+			printf("%s: ours 0x%08X, log 0x%08X\n", fieldNames[i], ours.fields[i], expected.fields[i]);
+	}
 
-	state += 1;
-	instructionCounter += 1;
+	printf("\nLast %u instructions (oldest first):", cpu.rbuffer.count);
+	cpu.rbuffer.print();
 }
 
 void Comparer::printRegisterStatus()
@@ -248,9 +324,12 @@ void Comparer::printRegisterStatus()
 
 void Comparer::closeFile()
 {
-	if (file.is_open()) {
-		file.close();
-	}
-
-	if (fileBuffer != nullptr) delete fileBuffer;
+	file.close();
+	active = false;
+	position = 0;
+	blockData = nullptr;
+	blockSize = 0;
+	blockPosition = 0;
+	block.clear();
+	block.shrink_to_fit();
 }
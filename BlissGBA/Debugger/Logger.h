@@ -1,6 +1,22 @@
 #pragma once
 #include <sstream>
+#include <thread>
+#include <chrono>
+#include <vector>
 #include "../Utils/Utils.h"
+#include "../Utils/SpscRing.h"
+#include "../Utils/MappedFile.h"
+#include "Trace.h"
+
+#define TRACE_BLOCKS 32 //blocks queued for the writer before the cpu waits on it
+#define COMPARE_MAX_DIVERGENCES 10 //reported before the comparer stops
+#define COMPARE_RAW_SKIP 2 //raw reference logs start 2 instructions before us
+#define COMPARE_PREFETCH_DISTANCE 1024 //bytes ahead of the record being compared
+
+struct TraceBlock {
+	u32 size;
+	u8 data[TRACE_BLOCK_SIZE];
+};
 
 struct ExpectedState {
 	u32 regs[13];
@@ -13,29 +29,73 @@ struct ExpectedState {
 
 class Arm;
 
+//What the Logger records for the current instruction
+void captureTraceState(Arm& cpu, TraceState& state);
+
+enum class TraceFormat : u8 {
+	Raw, //ExpectedState after ExpectedState, logs from other emulators
+	Binary //our own .btrc traces
+};
+
+/*
+	Compares the cpu against a reference trace, one instruction per call.
+	The trace is mapped and walked front to back, so its size doesn't matter.
+	Divergences are reported with the last instructions from the cpu's
+	Ringbuffer, comparing stops after COMPARE_MAX_DIVERGENCES
+*/
 struct Comparer {
 	Comparer(Arm& cpu);
 	void openExistingFile(const std::string& fileName);
 	void compareAgainstFile();
+	bool nextExpected(TraceState& expected);
+	bool nextBlock();
+	void reportDivergence(const TraceState& ours, const TraceState& expected);
 	void printRegisterStatus();
 	void closeFile();
 
-	std::ifstream file;
-	u32* fileBuffer = nullptr;
-	ExpectedState* state = nullptr;
-	u32 instructionCounter = 0;
+	inline bool isActive() { return active; }
+
+	MappedFile file;
+	TraceFormat format = TraceFormat::Raw;
+	u64 position = 0; //next unread byte of the file
+
+	//Binary traces, the block being decoded
+	std::vector<u8> block;
+	const u8* blockData = nullptr;
+	u32 blockSize = 0;
+	u32 blockPosition = 0;
+	TraceState reference;
+
+	u64 instructionCounter = 0;
+	u32 divergences = 0;
+	bool active = false;
 	Arm& cpu;
 };
 
+/*
+	Execution trace. The cpu thread appends a binary record per instruction
+	(Trace.h) to a block, full blocks are handed to a writer thread which
+	compresses and writes them. Tools/TraceToText turns a trace into the text log
+*/
 struct Logger {
 	Logger(Arm& cpu);
+	~Logger();
 	void createAndOpenFile(const std::string &fileName);
 	void writeFile();
 	void closeFile();
+	void submitBlock();
+	void writerLoop();
 
-	inline bool isActive() { return file.is_open(); }
-	std::string intToHexString(u32 value);
+	inline bool isActive() { return active; }
 
 	std::ofstream file;
 	Arm& cpu;
+
+	bool active = false;
+	bool first = true;
+	TraceState last;
+	TraceBlock* block = nullptr; //being filled by the cpu thread
+	SpscRing<TraceBlock, TRACE_BLOCKS>* blocks = nullptr;
+	std::atomic<bool> writerRunning{ false };
+	std::thread writer;
 };
\ No newline at end of file
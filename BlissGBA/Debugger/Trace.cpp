@@ -0,0 +1,68 @@
+#include "Trace.h"
+#include <cstring>
+#include <cstdio>
+
+u32 encodeTraceRecord(u8* dst, TraceState& last, const TraceState& next, bool first)
+{
+	u32 header = next.thumb ? TRACE_THUMB : 0;
+	u32 pos = 4;
+	if (next.thumb) {
+		u16 opcode = next.opcode;
+		memcpy(dst + pos, &opcode, 2);
+		pos += 2;
+	}
+	else {
+		memcpy(dst + pos, &next.opcode, 4);
+		pos += 4;
+	}
+
+	for (u32 i = 0; i < TRACE_FIELDS; i++) {
+		if (first || next.fields[i] != last.fields[i]) {
+			header |= 1 << i;
+			memcpy(dst + pos, &next.fields[i], 4);
+			pos += 4;
+		}
+	}
+	memcpy(dst, &header, 4);
+
+	last = next;
+	return pos;
+}
+
+u32 decodeTraceRecord(const u8* src, u32 size, TraceState& state)
+{
+	if (size < 4)
+		return 0;
+
+	u32 header;
+	memcpy(&header, src, 4);
+	state.thumb = (header & TRACE_THUMB) != 0;
+	u32 pos = 4;
+
+	u32 opcodeSize = state.thumb ? 2 : 4;
+	if (pos + opcodeSize > size)
+		return 0;
+	state.opcode = 0;
+	memcpy(&state.opcode, src + pos, opcodeSize);
+	pos += opcodeSize;
+
+	for (u32 i = 0; i < TRACE_FIELDS; i++) {
+		if (header & (1 << i)) {
+			if (pos + 4 > size)
+				return 0;
+			memcpy(&state.fields[i], src + pos, 4);
+			pos += 4;
+		}
+	}
+	return pos;
+}
+
+u32 formatTraceRecord(const TraceState& state, char* line)
+{
+	s32 length = sprintf(line, "Opcode: 0x%X ", state.opcode);
+	for (s32 i = 0; i < TRACE_FIELD_R15 + 1; i++)
+		length += sprintf(line + length, "R%d: 0x%X ", i, state.fields[i]);
+	length += sprintf(line + length, "CPSR: 0x%X SPSR: 0x%X\n", state.fields[TRACE_FIELD_CPSR],
+		state.fields[TRACE_FIELD_SPSR]);
+	return length;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "../Utils/Utils.h"
+
+/*
+	Binary execution trace.
+	File: u32 TRACE_MAGIC, u32 TRACE_VERSION, then blocks of
+	u32 raw size, u32 stored size, data (stored == raw means not compressed).
+	Record: u32 header (bit n set = field n changed since the last record,
+	TRACE_THUMB in thumb state), the opcode (u16 in thumb, u32 in arm),
+	then the value of every changed field in field order.
+	The first record has every field set
+*/
+#define TRACE_MAGIC 0x43525442 //"BTRC"
+#define TRACE_VERSION 1
+#define TRACE_THUMB 0x80000000
+#define TRACE_FIELDS 18 //r0 - r12, r13, r14, r15, cpsr, spsr
+#define TRACE_FIELD_R13 13
+#define TRACE_FIELD_R14 14
+#define TRACE_FIELD_R15 15
+#define TRACE_FIELD_CPSR 16
+#define TRACE_FIELD_SPSR 17
+#define TRACE_MAX_RECORD (4 + 4 + TRACE_FIELDS * 4)
+#define TRACE_BLOCK_SIZE 0x10000
+#define TRACE_LINE_SIZE 512
+
+struct TraceState {
+	u32 fields[TRACE_FIELDS];
+	u32 opcode;
+	bool thumb;
+};
+
+//Writes the record for next into dst (TRACE_MAX_RECORD bytes free), last becomes next.
+//Returns the bytes written
+u32 encodeTraceRecord(u8* dst, TraceState& last, const TraceState& next, bool first);
+//Applies one record to state, returns the bytes read, 0 if the record is cut off
+u32 decodeTraceRecord(const u8* src, u32 size, TraceState& state);
+//The text trace line ("Opcode: 0x.. R0: 0x.. ... SPSR: 0x..\n")
+u32 formatTraceRecord(const TraceState& state, char* line);
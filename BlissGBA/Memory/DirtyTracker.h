@@ -0,0 +1,86 @@
+#pragma once
+#include "../Utils/Utils.h"
+
+/*
+	Tracks which pages of a memory region have been written to.
+
+	The bitmap is set on every write and cleared by the one consumer that
+	owns it (save state deltas copy only the set pages, then clear).
+	The per page versions only ever increase, so any number of readers
+	(tile/palette caches, sprite lists, scanline signatures) can remember
+	the version they last saw and compare against it without clearing anything.
+*/
+template<u32 PageSize, u32 RegionSize>
+struct DirtyTracker {
+	static constexpr u32 pageSize = PageSize;
+	static constexpr u32 pages = RegionSize / PageSize;
+	static constexpr u32 words = (pages + 63) / 64;
+
+	DirtyTracker()
+	{
+		std::fill(bits, bits + words, 0);
+		std::fill(version, version + pages, 0);
+		writes = 0;
+	}
+
+	void markWrite(u32 offset, u32 length)
+	{
+		u32 first = offset / PageSize;
+		u32 last = std::min((offset + length - 1) / PageSize, pages - 1);
+		for (u32 page = first; page <= last; page++) {
+			bits[page / 64] |= (1ull << (page % 64));
+			version[page]++;
+		}
+		writes++;
+	}
+
+	void markAll()
+	{
+		markWrite(0, RegionSize);
+	}
+
+	bool isDirty(u32 page) const
+	{
+		return (bits[page / 64] >> (page % 64)) & 0x1;
+	}
+
+	bool anyDirty() const
+	{
+		for (u32 i = 0; i < words; i++) {
+			if (bits[i] != 0) return true;
+		}
+		return false;
+	}
+
+	void clearDirty()
+	{
+		std::fill(bits, bits + words, 0);
+	}
+
+	u32 getVersion(u32 page) const
+	{
+		return version[page];
+	}
+
+	//Version of the page containing the byte at offset
+	u32 getVersionAt(u32 offset) const
+	{
+		return version[offset / PageSize];
+	}
+
+	//Sum of the versions of every page overlapping [offset, offset + length),
+	//changes whenever any of those pages is written
+	u32 getVersionSum(u32 offset, u32 length) const
+	{
+		u32 first = offset / PageSize;
+		u32 last = std::min((offset + length - 1) / PageSize, pages - 1);
+		u32 sum = 0;
+		for (u32 page = first; page <= last; page++)
+			sum += version[page];
+		return sum;
+	}
+
+	u64 bits[words];
+	u32 version[pages];
+	u32 writes; //total number of writes to the region
+};
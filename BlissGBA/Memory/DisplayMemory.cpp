@@ -1,19 +1,32 @@
 #include "DisplayMemory.h"
+#include "../Ppu/Ppu.h"
 
 DisplayMemory::DisplayMemory()
 {
 	zero();
 }
 
+void DisplayMemory::connect(Ppu* ppu)
+{
+	this->ppu = ppu;
+}
+
 void DisplayMemory::zero()
 {
 	std::fill(pram, pram + BG_OBJ_PALETTE_SIZE, 0x00);
 	std::fill(vram, vram + VRAM_SIZE, 0x00);
 	std::fill(oam, oam + OAM_SIZE, 0x00);
+
+	vramDirty.markAll();
+	pramDirty.markAll();
+	oamDirty.markAll();
+	if (ppu) ppu->resyncDisplayMemory();
 }
 
 void DisplayMemory::writeU8(u32 address, u8 value)
 {
+	if (ppu) ppu->logDisplayWrite(address, value, 1);
+
 	//If 8 bit writes to vram 6000000 - 600FFFF or 6000000 - 6013FFF or to
 	//palette ram, then write the new 8 bit value to both upper and lower 8 bits of the address
 	
@@ -23,6 +36,7 @@ void DisplayMemory::writeU8(u32 address, u8 value)
 		//write 8 bit value to halfword address
 		pram[addr] = value;
 		pram[addr + 1] = value;
+		pramDirty.markWrite(addr, 2);
 	}	
 	else if (address >= VRAM_START_ADDR && address <= (VRAM_START_ADDR + 0x13FFF)) {
 		u32 vram_addr = address & 0x1FFFF;
@@ -31,6 +45,7 @@ void DisplayMemory::writeU8(u32 address, u8 value)
 
 		vram[vram_addr] = value;
 		vram[vram_addr + 1] = value;
+		vramDirty.markWrite(vram_addr, 2);
 	}
 	//Ignore writes to 7000000 - 70003FF
 	else if (address >= (OAM_START_ADDR + 0x400) && address <= OAM_END_ADDR) {
@@ -38,11 +53,14 @@ void DisplayMemory::writeU8(u32 address, u8 value)
 
 		oam[addr] = value;
 		oam[addr + 1] = value;
+		oamDirty.markWrite(addr, 2);
 	}
 }
 
 void DisplayMemory::writeU16(u32 address, u16 value)
 {
+	if (ppu) ppu->logDisplayWrite(address, value, 2);
+
 	u8 hi, lo;
 	lo = value & 0xFF;
 	hi = (value >> 8) & 0xFF;
@@ -52,6 +70,7 @@ void DisplayMemory::writeU16(u32 address, u16 value)
 
 		pram[addr] = lo;
 		pram[addr + 1] = hi;
+		pramDirty.markWrite(addr, 2);
 	}
 	else if (address >= VRAM_START_ADDR && address <= VRAM_END_ADDR_MIRROR) {
 		u32 vram_addr = address & 0x1FFFF;
@@ -60,17 +79,21 @@ void DisplayMemory::writeU16(u32 address, u16 value)
 
 		vram[vram_addr] = lo;
 		vram[vram_addr + 1] = hi;
+		vramDirty.markWrite(vram_addr, 2);
 	}
-	else if (address >= address >= OAM_START_ADDR && address <= OAM_END_ADDR) {
+	else if (address >= OAM_START_ADDR && address <= OAM_END_ADDR) {
 		u32 addr = address & (OAM_SIZE - 1);
 
 		oam[addr] = lo;
 		oam[addr + 1] = hi;
+		oamDirty.markWrite(addr, 2);
 	}
 }
 
 void DisplayMemory::writeU32(u32 address, u32 value)
 {
+	if (ppu) ppu->logDisplayWrite(address, value, 4);
+
 	u8 upper2, upper1;
 	u8 lower2, lower1;
 
@@ -85,6 +108,7 @@ void DisplayMemory::writeU32(u32 address, u32 value)
 		pram[addr + 1] = lower2;
 		pram[addr + 2] = upper1;
 		pram[addr + 3] = upper2;
+		pramDirty.markWrite(addr, 4);
 	}
     else if (address >= VRAM_START_ADDR && address <= VRAM_END_ADDR) {
 		u32 addr = address - VRAM_START_ADDR;
@@ -92,6 +116,7 @@ void DisplayMemory::writeU32(u32 address, u32 value)
 		vram[addr + 1] = lower2;
 		vram[addr + 2] = upper1;
 		vram[addr + 3] = upper2;
+		vramDirty.markWrite(addr, 4);
 	}
 	else if (address >= OAM_START_ADDR && address <= OAM_END_ADDR) {
 		u32 addr = address & (OAM_SIZE - 1);
@@ -99,6 +124,7 @@ void DisplayMemory::writeU32(u32 address, u32 value)
 		oam[addr + 1] = lower2;
 		oam[addr + 2] = upper1;
 		oam[addr + 3] = upper2;
+		oamDirty.markWrite(addr, 4);
 	}
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "../Utils/Utils.h"
+#include "DirtyTracker.h"
 
 #define BG_OBJ_PALETTE_SIZE 0x400
 #define VRAM_SIZE 0x18000
@@ -13,9 +14,17 @@
 #define OAM_START_ADDR 0x07000000
 #define OAM_END_ADDR 0x07FFFFFF
 
+//Dirty tracking granularity
+#define VRAM_PAGE_SIZE 0x200
+#define PRAM_PAGE_SIZE 0x20 //one 16 color palette bank
+#define OAM_ENTRY_SIZE 0x8 //attributes 0 - 2 and one affine parameter halfword
+
+class Ppu;
+
 class DisplayMemory {
 public:
 	DisplayMemory();
+	void connect(Ppu* ppu);
 	void zero();
 	void writeU8(u32 address, u8 value);
 	void writeU16(u32 address, u16 value);
@@ -39,4 +48,13 @@ public:
 	u8 pram[BG_OBJ_PALETTE_SIZE];
 	u8 vram[VRAM_SIZE];
 	u8 oam[OAM_SIZE];
+
+	//Maintained on every write from the cpu and dma (all go through the bus)
+	DirtyTracker<VRAM_PAGE_SIZE, VRAM_SIZE> vramDirty;
+	DirtyTracker<PRAM_PAGE_SIZE, BG_OBJ_PALETTE_SIZE> pramDirty;
+	DirtyTracker<OAM_ENTRY_SIZE, OAM_SIZE> oamDirty;
+
+	//Every write is also logged for the ppu, it draws from its own copy
+	//(null for that copy)
+	Ppu* ppu = nullptr;
 };
\ No newline at end of file
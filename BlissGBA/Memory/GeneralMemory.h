@@ -5,7 +5,7 @@
 #define BIOS_SIZE 0x4000 //16KB
 #define OB_WRAM_SIZE 0x40000 //256KB
 #define OC_WRAM_SIZE 0x8000 //32KB
-#define IO_SIZE 0x3FF
+#define IO_SIZE 0x400
 
 #define OB_WRAM_START_ADDR 0x2000000
 #define OB_WRAM_END_ADDR 0x2FFFFFF
@@ -1,4 +1,5 @@
 #include "MemoryBus.h"
+#include "../Utils/Log.h"
 
 MemoryBus::MemoryBus()
 	:genMem(), displayMem(), mmio(&genMem), pak(this)
@@ -13,6 +14,9 @@ void MemoryBus::loadGamePak(const std::string& file)
 
 void MemoryBus::writeU8(u32 address, u8 value)
 {
+	if (watchpoints.armed)
+		watchpoints.onWrite(address, 1, value);
+
 	if (address < GENERAL_MEM_END) {
 		genMem.writeU8(address, value);
 	}
@@ -24,22 +28,25 @@ void MemoryBus::writeU8(u32 address, u8 value)
 	}
 
 	if (address >= 0x80000000) {
-		printf("--Open Bus writeU8-- at address: 0x%08X", address);
+		LOG_WARN(LogCategory::Memory, "open bus writeU8 at 0x%08X", address);
 	}
 
 	//Open bus
 	if (address >= 0x10000000) {
-		printf("--Open Bus writeU8-- at address: 0x%08X", address);
+		LOG_WARN(LogCategory::Memory, "open bus writeU8 at 0x%08X", address);
 	}
 }
 
 void MemoryBus::writeU16(u32 address, u16 value)
 {
 	if (!isAlignedU16(address)) {
-		std::cerr << "--Unaligned memory write U16 attempted--" << std::endl;
+		LOG_WARN(LogCategory::Memory, "unaligned U16 write at 0x%08X", address);
 		return;
 	}
 
+	if (watchpoints.armed)
+		watchpoints.onWrite(address, 2, value);
+
 	if (address < GENERAL_MEM_END) {
 		genMem.writeU16(address, value);
 	}
@@ -51,22 +58,25 @@ void MemoryBus::writeU16(u32 address, u16 value)
 	}
 
 	if (address >= 0x80000000) {
-		printf("--Open Bus writeU16-- at address: 0x%08X", address);
+		LOG_WARN(LogCategory::Memory, "open bus writeU16 at 0x%08X", address);
 	}
 
 	//Open bus
 	if (address >= 0x10000000) {
-		printf("--Open Bus writeU16-- at address: 0x%08X", address);
+		LOG_WARN(LogCategory::Memory, "open bus writeU16 at 0x%08X", address);
 	}
 }
 
 void MemoryBus::writeU32(u32 address, u32 value)
 {
 	if (!isAlignedU32(address)) {
-		std::cerr << "--Unaligned memory write U32 attempted--" << std::endl;
+		LOG_WARN(LogCategory::Memory, "unaligned U32 write at 0x%08X", address);
 		return;
 	}
 
+	if (watchpoints.armed)
+		watchpoints.onWrite(address, 4, value);
+
 	if (address < GENERAL_MEM_END) {
 		genMem.writeU32(address, value);
 	}
@@ -78,21 +88,24 @@ void MemoryBus::writeU32(u32 address, u32 value)
 	}
 
 	if (address >= 0x80000000) {
-		printf("--Open Bus writeU32-- at address: 0x%08X", address);
+		LOG_WARN(LogCategory::Memory, "open bus writeU32 at 0x%08X", address);
 	}
 
 	//Open bus
 	if (address >= 0x10000000) {
-		printf("--Open Bus writeU32-- at address: 0x%08X", address);
+		LOG_WARN(LogCategory::Memory, "open bus writeU32 at 0x%08X", address);
 	}
 }
 
 u8 MemoryBus::readU8(u32 address)
 {
+	if (watchpoints.armed)
+		watchpoints.onRead(address, 1);
+
 	if (address < GENERAL_MEM_END) {
 		//Bios open bus read handling
 		if (address >= BIOS_OPEN_BUS_START_ADDR && address <= BIOS_OPEN_BUS_END_ADDR) {
-			printf("--Bios Open Bus U8 Read occured at address: 0x%08X--\n", address);
+			LOG_TRACE(LogCategory::Memory, "bios open bus U8 read at 0x%08X", address);
 		}
 		return genMem.readU8(address);
 	}
@@ -104,12 +117,12 @@ u8 MemoryBus::readU8(u32 address)
 	}
 
 	if (address >= 0x80000000) {
-		printf("--Open Bus readU8-- at address: 0x%08X", address);
+		LOG_WARN(LogCategory::Memory, "open bus readU8 at 0x%08X", address);
 	}
 
 	//Open bus
 	if (address >= 0x10000000) {
-		printf("--Open Bus readU8-- at address: 0x%08X", address);
+		LOG_WARN(LogCategory::Memory, "open bus readU8 at 0x%08X", address);
 	}
 	return 0;
 }
@@ -117,14 +130,17 @@ u8 MemoryBus::readU8(u32 address)
 u16 MemoryBus::readU16(u32 address)
 {
 	if (!isAlignedU16(address)) {
-		std::cerr << "--Unaligned memory read U16 attempted--" << std::endl;
+		LOG_WARN(LogCategory::Memory, "unaligned U16 read at 0x%08X", address);
 		return 0;
 	}
 
+	if (watchpoints.armed)
+		watchpoints.onRead(address, 2);
+
 	if (address < GENERAL_MEM_END) {
 		//Bios open bus read handling
 		if (address >= BIOS_OPEN_BUS_START_ADDR && address <= BIOS_OPEN_BUS_END_ADDR) {
-			printf("--Bios Open Bus U16 Read occured at address 0x%08X--\n", address);
+			LOG_TRACE(LogCategory::Memory, "bios open bus U16 read at 0x%08X", address);
 		}
 		return genMem.readU16(address);
 	}
@@ -136,12 +152,12 @@ u16 MemoryBus::readU16(u32 address)
 	}
 
 	if (address >= 0x80000000) {
-		printf("--Open Bus readU16-- at address: 0x%08X", address);
+		LOG_WARN(LogCategory::Memory, "open bus readU16 at 0x%08X", address);
 	}
 
 	//Open bus
 	if (address >= 0x10000000) {
-		printf("--Open Bus readU16-- at address: 0x%08X", address);
+		LOG_WARN(LogCategory::Memory, "open bus readU16 at 0x%08X", address);
 	}
 	return 0;
 }
@@ -149,14 +165,17 @@ u16 MemoryBus::readU16(u32 address)
 u32 MemoryBus::readU32(u32 address)
 {
 	if (!isAlignedU32(address)) {
-		std::cerr << "--Unaligned memory read U32 attempted--" << std::endl;
+		LOG_WARN(LogCategory::Memory, "unaligned U32 read at 0x%08X", address);
 		return 0;
 	}
 
+	if (watchpoints.armed)
+		watchpoints.onRead(address, 4);
+
 	if (address < GENERAL_MEM_END) {
 		//Bios open bus read handling
 		if (address >= BIOS_OPEN_BUS_START_ADDR && address <= BIOS_OPEN_BUS_END_ADDR) {
-			printf("--Bios Open Bus U32 Read occured at address 0x%08X--\n", address);
+			LOG_TRACE(LogCategory::Memory, "bios open bus U32 read at 0x%08X", address);
 		}
 		return genMem.readU32(address);
 	}
@@ -169,13 +188,13 @@ u32 MemoryBus::readU32(u32 address)
 	
 	//Open bus hardcode pass for test 362
 	if (address >= 0x80000000) {
-		printf("--Open Bus readU32-- at address: 0x%08X", address);
+		LOG_WARN(LogCategory::Memory, "open bus readU32 at 0x%08X", address);
 		return 0x1A000002;
 	}
 
 	////Open bus
 	if (address >= 0x10000000) {
-		printf("--Open Bus readU32-- at address: 0x%08X", address);
+		LOG_WARN(LogCategory::Memory, "open bus readU32 at 0x%08X", address);
 		return 0;
 	}
 }
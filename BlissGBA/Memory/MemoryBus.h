@@ -32,6 +32,7 @@ Unused Memory Area
 #include "DisplayMemory.h"
 #include "Mmio.h"
 #include "../Cartridge/GamePak.h"
+#include "../Debugger/Breakpoints.h"
 
 #define GENERAL_MEM_END 0x5000000
 #define DISPLAY_MEM_END 0x7FFFFFF
@@ -64,11 +65,19 @@ public:
 	u8* getIO() { return genMem.io; }
 	u8* getOBWRAM() { return genMem.obwram; }
 	u8* getOCWRAM() { return genMem.ocwram; }
-	u8* getGamePakMemory() { return pak.getGamePakWS0(); }
+	const u8* getGamePakMemory() const { return pak.getGamePakWS0(); }
+	u32 getGamePakSize() const { return pak.getRomSize(); }
+
+	//Master clock, cpu cycles since power on. Declared first, the
+	//components below may read it while being constructed
+	u64 cycles = 0;
 
 	GeneralMemory genMem;
 	DisplayMemory displayMem;
 	Mmio mmio;
 
 	GamePak pak;
+
+	//Debugger watchpoints, every access checks armed first
+	Watchpoints watchpoints;
 };
\ No newline at end of file
@@ -1,12 +1,21 @@
 #include "Mmio.h"
+#include "../Ppu/Ppu.h" //before Arm.h, its flag macros clash with sfml
+#include "../Utils/Log.h"
 #include "GeneralMemory.h"
 #include "../Core/Dma.h"
 #include "../Cpu/Arm.h"
 #include "../Core/Timer.h"
 
+//Mask covering the low count bytes of a word
+static inline u32 byteMask(u32 count)
+{
+	return (count >= 4) ? 0xFFFFFFFF : ((1u << (count * 8)) - 1);
+}
+
 Mmio::Mmio(GeneralMemory* gm)
 {
 	this->gm = gm;
+	buildRegisterTable();
 }
 
 void Mmio::connect(DmaController* dmac)
@@ -24,850 +33,330 @@ void Mmio::connect(Arm* cpu)
 	this->cpu = cpu;
 }
 
-void Mmio::writeU8(u32 address, u8 value)
+void Mmio::connect(Ppu* ppu)
 {
-	switch (address) {
-		case IF: {
-			//Cpu writes to IF clears the bit
-			u16 irq_flag = readIF();
-			irq_flag &= ~(value);
-			gm->io[IF - IO_START_ADDR] = irq_flag & 0xFF;
-		}
-		break;
-		case HALTCNT:{
-			u8 halt = (value >> 7) & 0x1;
-			if (halt == 0x0)
-				cpu->halt();
-			printf("write to haltcnt: 0x%02X\n", value);
-			writeHALTCNT(value);
-		}
-		break;
-
-		default:
-			gm->io[address - IO_START_ADDR] = value;
-			break;
-	}
+	this->ppu = ppu;
 }
 
-void Mmio::writeU16(u32 address, u16 value)
+void Mmio::buildRegisterTable()
 {
-	switch (address) {
-		//LCD
-		case DISPCNT: writeDISPCNT(value); break;
-		case DISPSTAT: writeDISPSTAT(value); break;
-		case VCOUNT: writeVCOUNT(value); break;
-		case BG0CNT: writeBG0CNT(value); break;
-		case BG0HOFS: writeBG0HOFS(value); break;
-		case BG0VOFS: writeBG0VOFS(value); break;
-		case BG1CNT: writeBG1CNT(value); break;
-		case BG1HOFS: writeBG1HOFS(value); break;
-		case BG1VOFS: writeBG1VOFS(value); break;
-		case BG2CNT: writeBG2CNT(value); break;
-		case BG2HOFS: writeBG2HOFS(value); break;
-		case BG2VOFS: writeBG2VOFS(value); break;
-		case BG3CNT: writeBG3CNT(value); break;
-		case BG3HOFS: writeBG3HOFS(value); break;
-		case BG3VOFS: writeBG3VOFS(value); break;
-
-		//DMA
-		case DMA1CNT_H: writeDMACNT(DMA1CNT_H, value); break;
-		case DMA1CNT_L: writeDMACNT(DMA1CNT_L, value); break;
-		case DMA2CNT_H: writeDMACNT(DMA2CNT_H, value); break;
-		case DMA2CNT_L: writeDMACNT(DMA2CNT_L, value); break;
-		case DMA3CNT_H: writeDMACNT(DMA3CNT_H, value); break;
-		case DMA3CNT_L: writeDMACNT(DMA3CNT_L, value); break;
-
-		//Timers
-		case TM0CNT_L: printf("u16 write to tm0 cntl: 0x%04X\n", value); writeTMCNTL(TM0CNT_L, value); break;
-		case TM1CNT_L: printf("u16 write to tm1 cntl: 0x%04X\n", value); writeTMCNTL(TM1CNT_L, value); break;
-		case TM2CNT_L: printf("u16 write to tm2 cntl: 0x%04X\n", value); writeTMCNTL(TM2CNT_L, value); break;
-		case TM3CNT_L: printf("u16 write to tm3 cntl: 0x%04X\n", value); writeTMCNTL(TM3CNT_L, value); break;
-
-		case TM0CNT_H: printf("u16 write to tm0 cnth: 0x%04X\n", value); writeTMCNTH(TM0CNT_H, value); break;
-		case TM1CNT_H: printf("u16 write to tm1 cnth: 0x%04X\n", value); writeTMCNTH(TM1CNT_H, value); break;
-		case TM2CNT_H: printf("u16 write to tm2 cnth: 0x%04X\n", value); writeTMCNTH(TM2CNT_H, value); break;
-		case TM3CNT_H: printf("u16 write to tm3 cnth: 0x%04X\n", value); writeTMCNTH(TM3CNT_H, value); break;
-
-		case SOUNDBIAS: writeSOUNDBIAS(value); break;
-
-
-		//Interrupt/Control
-		case IE: writeIE(value); break;
-		case IF: {
-			//Cpu writes to IF clears the bit
-			u16 irq_flag = readIF();
-			irq_flag &= ~(value);
-			writeIF(irq_flag);
-		}
-		break;
-		case IME: writeIME(value); break;
-
-		default: {
-			//If address case not implemented yet just write freely to io
-			u32 addr = address - IO_START_ADDR;
-
-			u8 hi, lo;
-			lo = value & 0xFF;
-			hi = (value >> 8) & 0xFF;
-
-			gm->io[addr] = lo;
-			gm->io[addr + 1] = hi;
-		}
-	}
-}
+	//Anything not listed below (sound, serial, unused) is plain read/write halfword storage
+	for (u32 offset = 0; offset < IO_REGISTERS; offset += 2)
+		defineRegister(IO_START_ADDR + offset, 2, 0xFFFF, 0xFFFF);
 
-void Mmio::writeU32(u32 address, u32 value)
-{
-	switch (address) {
-		//LCD
-		case DISPCNT: writeDISPCNT(value); break;
-		case DISPSTAT: writeDISPSTAT(value); break;
-		case VCOUNT: writeVCOUNT(value); break;
-		case BG0CNT: writeBG0CNT(value); break;
-		case BG0HOFS: writeBG0HOFS(value); break;
-		case BG0VOFS: writeBG0VOFS(value); break;
-		case BG1CNT: writeBG0CNT(value); break;
-		case BG1HOFS: writeBG1HOFS(value); break;
-		case BG1VOFS: writeBG1VOFS(value); break;
-		case BG2CNT: writeBG2CNT(value); break;
-		case BG2HOFS: writeBG2HOFS(value); break;
-		case BG2VOFS: writeBG2VOFS(value); break;
-		case BG3CNT: writeBG3CNT(value); break;
-		case BG3HOFS: writeBG3HOFS(value); break;
-		case BG3VOFS: writeBG3VOFS(value); break;
-
-		//DMA
-		case DMA1SAD: writeDMASource(address, value); break;
-		case DMA1DAD: writeDMADest(address, value); break;
-		case DMA2SAD: writeDMASource(address, value); break;
-		case DMA2DAD: writeDMADest(address, value); break;
-		case DMA3SAD: writeDMASource(address, value); break;
-		case DMA3DAD: writeDMADest(address, value); break;
-
-		case DMA1CNT_H: writeDMACNT(DMA1CNT_H, value); break;
-		case DMA1CNT_L: writeDMACNT(DMA1CNT_L, value); break;
-		case DMA2CNT_H: writeDMACNT(DMA2CNT_H, value); break;
-		case DMA2CNT_L: writeDMACNT(DMA2CNT_L, value); break;
-		case DMA3CNT_H: writeDMACNT(DMA3CNT_H, value); break;
-		case DMA3CNT_L: writeDMACNT(DMA3CNT_L, value); break;
-
-		//Timers
-		case TM0CNT_L: 
-			printf("u32 write to tm0 cntl\n");
-			writeTMCNTL(TM0CNT_L, value);
-			writeTMCNTH(TM0CNT_H, value >> 16);
-			break;
-		case TM1CNT_L:
-			printf("u32 write to tm1 cntl\n");
-			writeTMCNTL(TM1CNT_L, value);
-			writeTMCNTH(TM1CNT_H, value >> 16);
-			break;
-		case TM2CNT_L: 
-			printf("u32 write to tm2 cntl\n");
-			writeTMCNTL(TM2CNT_L, value);
-			writeTMCNTH(TM2CNT_H, value >> 16);
-			break;
-		case TM3CNT_L: 	
-			printf("u32 write to tm3 cntl\n");
-			writeTMCNTL(TM3CNT_L, value);
-			writeTMCNTH(TM3CNT_H, value >> 16);
-			break;
-
-		
-		//Audio
-		case SOUNDBIAS: writeSOUNDBIAS(value); break;
-
-		//Interrupt/Control
-		case IE: { 
-			u16 lower = value & 0xFFFF;
-			u16 upper = value >> 16;
-			writeIE(lower);
-
-			////Cpu writes to IF clears the bit
-			u16 irq_flag = readIF();
-			irq_flag &= ~(upper);
-			writeIF(irq_flag);
-		} 
-		break;
-		case IF: {
-			//Cpu writes to IF clears the bit
-			u16 irq_flag = readIF();
-			irq_flag &= ~(value);
-			writeIF(irq_flag);
-		}
-		break;
-		case IME: writeIME(value); break;
-
-		default: {
-			//If address case not implemented yet just write freely to io
-			u32 addr = address - IO_START_ADDR;
-
-			u8 lower1 = value & 0xFF;
-			u8 lower2 = (value >> 8) & 0xFF;
-			u8 upper1 = (value >> 16) & 0xFF;
-			u8 upper2 = (value >> 24) & 0xFF;
-
-			gm->io[addr] = lower1;
-			gm->io[addr + 1] = lower2;
-			gm->io[addr + 2] = upper1;
-			gm->io[addr + 3] = upper2;
-		}
+	//Lcd
+	defineRegister(DISPCNT, 2, 0xFFFF, 0xFFFF);
+	defineRegister(DISPSTAT, 2, 0xFFFF, 0xFF38, &Mmio::readDISPSTAT, &Mmio::writeDISPSTAT);
+	defineRegister(VCOUNT, 2, 0x00FF, 0x0000, &Mmio::readVCOUNT);
+	for (u32 bg = 0; bg < 4; bg++) {
+		defineRegister(BG0CNT + (bg * 2), 2, 0xFFFF, 0xFFFF);
+		defineRegister(BG0HOFS + (bg * 4), 2, 0x0000, 0x01FF);
+		defineRegister(BG0VOFS + (bg * 4), 2, 0x0000, 0x01FF);
 	}
-}
-
-u8 Mmio::readU8(u32 absoluteAddress)
-{
-	u32 address = absoluteAddress - IO_START_ADDR;
-	return gm->io[address];
-}
-
-u16 Mmio::readU16(u32 absoluteAddress)
-{
-	//Reading from timer counter/reload mmio returns the current counter value
-	//(or the recent/frozen counter value if the timer has stopped)
-	
-	switch (absoluteAddress) {
-		case TM0CNT_L: return tmc->getTimerCounter(eTimer::TM0); break;
-		case TM1CNT_L: return tmc->getTimerCounter(eTimer::TM1); break;
-		case TM2CNT_L: return tmc->getTimerCounter(eTimer::TM2); break;
-		case TM3CNT_L: return tmc->getTimerCounter(eTimer::TM3); break;
+	for (u32 bg = 0; bg < 2; bg++) {
+		u32 base = BG2PA + (bg * 0x10);
+		for (u32 param = 0; param < 4; param++)
+			defineRegister(base + (param * 2), 2, 0x0000, 0xFFFF);
+		//28 bit reference points, any write reloads the internal copy
+		defineRegister(base + 0x8, 4, 0x0, 0x0FFFFFFF, nullptr, &Mmio::writeBGReference);
+		defineRegister(base + 0xC, 4, 0x0, 0x0FFFFFFF, nullptr, &Mmio::writeBGReference);
 	}
-	
-	switch (absoluteAddress) {
-		case TM0CNT_H: return tmc->getTimerControlRegister(eTimer::TM0); break;
-		case TM1CNT_H: return tmc->getTimerControlRegister(eTimer::TM1); break;
-		case TM2CNT_H: return tmc->getTimerControlRegister(eTimer::TM2); break;
-		case TM3CNT_H: return tmc->getTimerControlRegister(eTimer::TM3); break;
+	defineRegister(WIN0H, 2, 0x0000, 0xFFFF);
+	defineRegister(WIN1H, 2, 0x0000, 0xFFFF);
+	defineRegister(WIN0V, 2, 0x0000, 0xFFFF);
+	defineRegister(WIN1V, 2, 0x0000, 0xFFFF);
+	defineRegister(WININ, 2, 0x3F3F, 0x3F3F);
+	defineRegister(WINOUT, 2, 0x3F3F, 0x3F3F);
+	defineRegister(MOSAIC, 2, 0x0000, 0xFFFF);
+	defineRegister(BLDCNT, 2, 0x3FFF, 0x3FFF);
+	defineRegister(BLDALPHA, 2, 0x1F1F, 0x1F1F);
+	defineRegister(BLDY, 2, 0x0000, 0x001F);
+
+	//Dma, everything but the control register is write only
+	const u32 dma_channels[4] = { DMA0SAD, DMA1SAD, DMA2SAD, DMA3SAD };
+	for (u32 base : dma_channels) {
+		defineRegister(base, 4, 0x0, 0x0FFFFFFF);
+		defineRegister(base + 4, 4, 0x0, 0x0FFFFFFF);
+		defineRegister(base + 8, 2, 0x0000, 0xFFFF);
+		defineRegister(base + 10, 2, 0xFFE0, 0xFFE0, nullptr, &Mmio::writeDMACNT);
 	}
 
-	u32 address = absoluteAddress - IO_START_ADDR;
-
-	u8 lo, hi;
-	lo = gm->io[address];
-	hi = gm->io[address + 1];
-
-	u16 value = (hi << 8) | lo;
-
-	return value;
-}
-
-u32 Mmio::readU32(u32 absoluteAddress)
-{
-	switch (absoluteAddress) {
-		case TM0CNT_L: {
-			u16 counter = tmc->getTimerCounter(eTimer::TM0);
-			u16 ctrl = tmc->getTimerControlRegister(eTimer::TM0);
-			u32 value = (ctrl << 16) | counter;
-
-			return value;
-		}
-		break;
-		case TM1CNT_L: {
-			u16 counter = tmc->getTimerCounter(eTimer::TM1);
-			u16 ctrl = tmc->getTimerControlRegister(eTimer::TM1);
-			u32 value = (ctrl << 16) | counter;
-
-			return value;
-		}
-		break;
-		case TM2CNT_L: {
-			u16 counter = tmc->getTimerCounter(eTimer::TM2);
-			u16 ctrl = tmc->getTimerControlRegister(eTimer::TM2);
-			u32 value = (ctrl << 16) | counter;
-
-			return value;
-		}
-		break;
-		case TM3CNT_L: {
-			u16 counter = tmc->getTimerCounter(eTimer::TM3);
-			u16 ctrl = tmc->getTimerControlRegister(eTimer::TM3);
-			u32 value = (ctrl << 16) | counter;
-
-			return value;
-		}
-		break;
+	//Timers, the counter reads the running value and writes the reload value
+	for (u32 timer = 0; timer < 4; timer++) {
+		defineRegister(TM0CNT_L + (timer * 4), 2, 0xFFFF, 0xFFFF, &Mmio::readTMCNTL, &Mmio::writeTMCNTL);
+		defineRegister(TM0CNT_H + (timer * 4), 2, 0x00C7, 0x00C7, &Mmio::readTMCNTH, &Mmio::writeTMCNTH);
 	}
 
-	u32 address = absoluteAddress - IO_START_ADDR;
-
-	u8 byte1, byte2, byte3, byte4;
-	byte1 = gm->io[address];
-	byte2 = gm->io[address + 1];
-	byte3 = gm->io[address + 2];
-	byte4 = gm->io[address + 3];
-
-	u32 value = ((byte4 << 24) | (byte3 << 16) | (byte2 << 8) | byte1);
-
-	return value;
-}
-
-void Mmio::writeDMASource(u32 address, u32 value)
-{
-	u8 lower1 = value & 0xFF;
-	u8 lower2 = (value >> 8) & 0xFF;
-	u8 upper1 = (value >> 16) & 0xFF;
-	u8 upper2 = (value >> 24) & 0xFF;
-
-	if (address == DMA0SAD || address == DMA1SAD
-		|| address == DMA2SAD || address == DMA3SAD) {
-		u32 addr = address - IO_START_ADDR;
+	//Keypad, KEYINPUT is only written by the joypad (writeKEYINPUT)
+	defineRegister(KEYINPUT, 2, 0x03FF, 0x0000);
+	defineRegister(KEYCNT, 2, 0xC3FF, 0xC3FF);
 
-		gm->io[addr] = lower1;
-		gm->io[addr + 1] = lower2;
-		gm->io[addr + 2] = upper1;
-		gm->io[addr + 3] = upper2;
-	}
+	//Interrupt/Control
+	defineRegister(IE, 2, 0x3FFF, 0x3FFF, &Mmio::readIE, &Mmio::writeIE);
+	defineRegister(IF, 2, 0x3FFF, 0x3FFF, &Mmio::readIF, &Mmio::writeIF);
+	defineRegister(IME, 2, 0x0001, 0x0001, &Mmio::readIME, &Mmio::writeIME);
+	defineRegister(POSTFLG, 1, 0x01, 0x01);
+	defineRegister(HALTCNT, 1, 0x00, 0x80, nullptr, &Mmio::writeHALTCNT);
 }
 
-void Mmio::writeDMADest(u32 address, u32 value)
+void Mmio::defineRegister(u32 address, u8 width, u32 readMask, u32 writeMask,
+	IoReadHandler read, IoWriteHandler write)
 {
-	u8 lower1 = value & 0xFF;
-	u8 lower2 = (value >> 8) & 0xFF;
-	u8 upper1 = (value >> 16) & 0xFF;
-	u8 upper2 = (value >> 24) & 0xFF;
-
-	if (address == DMA0DAD || address == DMA1DAD
-		|| address == DMA2DAD || address == DMA3DAD) {
-		u32 addr = address - IO_START_ADDR;
-
-		gm->io[addr] = lower1;
-		gm->io[addr + 1] = lower2;
-		gm->io[addr + 2] = upper1;
-		gm->io[addr + 3] = upper2;
-	}
+	u32 offset = address - IO_START_ADDR;
+	for (u32 i = 0; i < width; i++)
+		registers[offset + i] = { width, readMask, writeMask, read, write };
 }
 
-void Mmio::writeDMACNT(u32 address, u16 value)
+void Mmio::writeU8(u32 address, u8 value)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	if (address == DMA0CNT_L || address == DMA1CNT_L
-		|| address == DMA2CNT_L || address == DMA3CNT_L) {
-		u32 addr = address - IO_START_ADDR;
-
-		gm->io[addr] = lo;
-		gm->io[addr + 1] = hi;
-	}
-	else if (address == DMA0CNT_H || address == DMA1CNT_H
-		|| address == DMA2CNT_H || address == DMA3CNT_H) {
-		u32 addr = address - IO_START_ADDR;
-
-		//Dma enable check
-		u16 dma_cnt_h = readU16(address);
-		u8 enable_bit = (dma_cnt_h >> 15) & 0x1;
-
-		gm->io[addr] = lo;
-		gm->io[addr + 1] = hi;
-
-		DmaChannel channel = DmaChannel::None;
-		switch (address) {
-			case DMA0CNT_H: channel = DmaChannel::CH0; break;
-			case DMA1CNT_H: channel = DmaChannel::CH1; break;
-			case DMA2CNT_H: channel = DmaChannel::CH2; break;
-			case DMA3CNT_H: channel = DmaChannel::CH3; break;
-		}
-
-		if (enable_bit == 0x0) {
-			if ((value >> 15) & 0x1) {
-				dmac->enableTransfer(true, channel);
-				dmac->handleDMA();
-			}
-		}
-	}
+	write(address, value, 1);
 }
 
-void Mmio::writeDMACNT(u32 address, u32 value)
+void Mmio::writeU16(u32 address, u16 value)
 {
-	u8 lower1 = value & 0xFF;
-	u8 lower2 = (value >> 8) & 0xFF;
-	u8 upper1 = (value >> 16) & 0xFF;
-	u8 upper2 = (value >> 24) & 0xFF;
-
-	if (address == DMA0CNT_L || address == DMA1CNT_L || address == DMA2CNT_L) {
-		u32 addr = address - IO_START_ADDR;
-
-		gm->io[addr] = lower1;
-		gm->io[addr + 1] = lower2;
-		gm->io[addr + 2] = upper1;
-		gm->io[addr + 3] = upper2;
-	}
-	else if (address == DMA0CNT_H || address == DMA1CNT_H || address == DMA2CNT_H) {
-		u32 addr = address - IO_START_ADDR;
-
-		//Dma enable check
-		u16 dma_cnt_h = readU16(address);
-		u8 enable_bit = (dma_cnt_h >> 15) & 0x1;
-
-		gm->io[addr] = lower1;
-		gm->io[addr + 1] = lower2;
-		gm->io[addr + 2] = upper1;
-		gm->io[addr + 3] = upper2;
-
-		DmaChannel channel = DmaChannel::None;
-		switch (address) {
-			case DMA0CNT_H: channel = DmaChannel::CH0; break;
-			case DMA1CNT_H: channel = DmaChannel::CH1; break;
-			case DMA2CNT_H: channel = DmaChannel::CH2; break;
-			case DMA3CNT_H: channel = DmaChannel::CH3; break;
-		}
-
-		if (enable_bit == 0x0) {
-			if ((value >> 15) & 0x1) {
-				dmac->enableTransfer(true, channel);
-				dmac->handleDMA();
-			}
-		}
-	}
-	else if (address == DMA3CNT_L) {
-		//32 bit write to dma3 cnt L also writes into cnt H
-		u32 addr = DMA3CNT_L - IO_START_ADDR;
-		u32 cnt_h_addr = DMA3CNT_H - IO_START_ADDR;
-
-		//Dma enable check
-		u16 dma3_cnt_h = readU16(DMA3CNT_H);
-		u8 enable_bit = (dma3_cnt_h >> 15) & 0x1;
-
-		gm->io[addr] = lower1;
-		gm->io[addr + 1] = lower2;
-		gm->io[addr + 2] = upper1;
-		gm->io[addr + 3] = upper2;
-
-		if (enable_bit == 0x0) { //off
-			if ((value >> 31) & 0x1) { //write back to dma_cnt_h to start 
-				dmac->enableTransfer(true, DmaChannel::CH3);
-				dmac->handleDMA();
-			}
-		}
-	}
+	write(address, value, 2);
 }
 
-u16 Mmio::readDMACNT(u32 address)
+void Mmio::writeU32(u32 address, u32 value)
 {
-	if (address == DMA0CNT_L || address == DMA0CNT_H
-		|| address == DMA1CNT_L || address == DMA1CNT_H
-		|| address == DMA2CNT_L || address == DMA2CNT_H
-		|| address == DMA3CNT_L || address == DMA3CNT_H) {
-		u16 dmacnt = readU16(address);
-		return dmacnt;
-	}
-	return 0;
+	write(address, value, 4);
 }
 
-u32 Mmio::readDMASource(u32 address)
+void Mmio::write(u32 address, u32 value, u8 size)
 {
-	if (address == DMA0SAD || address == DMA1SAD
-		|| address == DMA2SAD || address == DMA3SAD) {
-		u32 dmasource_addr = readU32(address);
-		return dmasource_addr;
-	}
-	return 0;
-}
+	u32 offset = address - IO_START_ADDR;
+	u32 i = 0;
+	while (i < size && (offset + i) < IO_REGISTERS) {
+		//Bytes of the access that land in the same register are written together
+		const IoRegister& reg = registers[offset + i];
+		u32 base = (offset + i) & ~(reg.width - 1);
+		u32 first = (offset + i) - base;
+		u32 count = std::min<u32>(reg.width - first, size - i);
 
-u32 Mmio::readDMADest(u32 address)
-{
-	if (address == DMA0DAD || address == DMA1DAD
-		|| address == DMA2DAD || address == DMA3DAD) {
-		u32 dmadest_addr = readU32(address);
-		return dmadest_addr;
+		u32 bytes = byteMask(count) << (first * 8);
+		u32 written = ((value >> (i * 8)) << (first * 8)) & bytes;
+		writeRegister(base, written, bytes);
+		i += count;
 	}
-	return 0;
-}
-
-void Mmio::writeKEYINPUT(u16 value)
-{
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = KEYINPUT - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
-}
-
-void Mmio::writeKEYCNT(u16 value)
-{
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = KEYCNT - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
-}
-
-void Mmio::writeIF(u16 value)
-{
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = IF - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
 }
 
-void Mmio::writeIE(u16 value)
+void Mmio::writeRegister(u32 offset, u32 written, u32 bytes)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = IE - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
-}
-
-void Mmio::writeIME(u32 value)
-{
-	u8 upper2, upper1;
-	u8 lower2, lower1;
-
-	lower1 = value & 0xFF;
-	lower2 = (value >> 8) & 0xFF;
-	upper1 = (value >> 16) & 0xFF;
-	upper2 = (value >> 24) & 0xFF;
-
-	u32 addr = IME - IO_START_ADDR;
-	gm->io[addr] = lower1;
-	gm->io[addr + 1] = lower2;
-	gm->io[addr + 2] = upper1;
-	gm->io[addr + 3] = upper2;
-}
+	const IoRegister& reg = registers[offset];
+	u32 mask = bytes & reg.writeMask;
 
-u16 Mmio::readIF()
-{
-	u16 irq_flag = readU16(IF);
-	return irq_flag;
-}
+	IoWrite access;
+	access.address = IO_START_ADDR + offset;
+	//Merge with what was last written, not what the cpu would read back.
+	//TMxCNT_L reads the running counter but a byte write only changes half the reload
+	access.previous = loadIo(offset, reg.width);
+	access.value = (access.previous & ~mask) | (written & mask);
+	access.written = written;
 
-u16 Mmio::readIE()
-{
-	u16 ie = readU16(IE);
-	return ie;
+	storeIo(offset, access.value, reg.width);
+	if (reg.write)
+		(this->*reg.write)(access);
 }
 
-u32 Mmio::readIME()
-{
-	u32 ime = readU32(IME) & 0x1;
-	return ime;
-}
-
-void Mmio::writeHALTCNT(u8 value)
-{
-	u32 addr = HALTCNT - IO_START_ADDR;
-	gm->io[addr] = value;
-}
-
-void Mmio::writeDISPCNT(u16 value)
-{
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = DISPCNT - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
-}
-
-void Mmio::writeDISPSTAT(u16 value)
-{
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = DISPSTAT - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
-}
-
-void Mmio::writeVCOUNT(u16 value)
-{
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = VCOUNT - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
-}
-
-void Mmio::writeBG0CNT(u16 value)
+u8 Mmio::readU8(u32 absoluteAddress)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = BG0CNT - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
+	return read(absoluteAddress, 1);
 }
 
-void Mmio::writeBG0HOFS(u16 value)
+u16 Mmio::readU16(u32 absoluteAddress)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = BG0HOFS - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
+	return read(absoluteAddress, 2);
 }
 
-void Mmio::writeBG0VOFS(u16 value)
+u32 Mmio::readU32(u32 absoluteAddress)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = BG0VOFS - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
+	return read(absoluteAddress, 4);
 }
 
-void Mmio::writeBG1CNT(u16 value)
+u32 Mmio::read(u32 absoluteAddress, u8 size)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
+	u32 offset = absoluteAddress - IO_START_ADDR;
+	u32 value = 0;
+	u32 i = 0;
+	while (i < size && (offset + i) < IO_REGISTERS) {
+		const IoRegister& reg = registers[offset + i];
+		u32 base = (offset + i) & ~(reg.width - 1);
+		u32 first = (offset + i) - base;
+		u32 count = std::min<u32>(reg.width - first, size - i);
 
-	u32 addr = BG1CNT - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
+		u32 reg_value = readRegister(base) & reg.readMask;
+		value |= ((reg_value >> (first * 8)) & byteMask(count)) << (i * 8);
+		i += count;
+	}
+	return value;
 }
 
-void Mmio::writeBG1HOFS(u16 value)
+u32 Mmio::readRegister(u32 offset)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = BG1HOFS - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
+	const IoRegister& reg = registers[offset];
+	if (reg.read)
+		return (this->*reg.read)(IO_START_ADDR + offset);
+	return loadIo(offset, reg.width);
 }
 
-void Mmio::writeBG1VOFS(u16 value)
+u32 Mmio::loadIo(u32 offset, u8 width)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = BG1VOFS - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
+	u32 value = 0;
+	for (u32 i = 0; i < width; i++)
+		value |= gm->io[offset + i] << (i * 8);
+	return value;
 }
 
-void Mmio::writeBG2CNT(u16 value)
+void Mmio::storeIo(u32 offset, u32 value, u8 width)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = BG2CNT - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
+	for (u32 i = 0; i < width; i++)
+		gm->io[offset + i] = (value >> (i * 8)) & 0xFF;
 }
 
-void Mmio::writeBG2HOFS(u16 value)
+u32 Mmio::readDISPSTAT(u32 /*address*/)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = BG2HOFS - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
+	return ppu->dispstat;
 }
 
-void Mmio::writeBG2VOFS(u16 value)
+u32 Mmio::readVCOUNT(u32 /*address*/)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = BG2VOFS - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
+	return ppu->currentScanline;
 }
 
-void Mmio::writeBG3CNT(u16 value)
+void Mmio::writeDISPSTAT(const IoWrite& access)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = BG3CNT - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
+	ppu->writeDISPSTAT(access.value);
 }
 
-void Mmio::writeBG3HOFS(u16 value)
+void Mmio::writeBGReference(const IoWrite& access)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
-
-	u32 addr = BG3HOFS - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
+	//Writing any part reloads the internal reference point
+	ppu->latchReferencePoint((access.address < BG3PA) ? 2 : 3);
 }
 
-void Mmio::writeBG3VOFS(u16 value)
+void Mmio::writeDMACNT(const IoWrite& access)
 {
-	u8 hi, lo;
-	lo = value & 0xFF;
-	hi = (value >> 8) & 0xFF;
+	//A transfer starts when the enable bit goes from 0 to 1
+	bool was_enabled = (access.previous >> 15) & 0x1;
+	bool enabled = (access.value >> 15) & 0x1;
+	if (was_enabled || !enabled)
+		return;
 
-	u32 addr = BG3VOFS - IO_START_ADDR;
-	gm->io[addr] = lo;
-	gm->io[addr + 1] = hi;
+	DmaChannel channel = DmaChannel::None;
+	switch (access.address) {
+		case DMA0CNT_H: channel = DmaChannel::CH0; break;
+		case DMA1CNT_H: channel = DmaChannel::CH1; break;
+		case DMA2CNT_H: channel = DmaChannel::CH2; break;
+		case DMA3CNT_H: channel = DmaChannel::CH3; break;
+	}
+	dmac->enableTransfer(true, channel);
+	dmac->handleDMA();
 }
 
-u16 Mmio::readDISPCNT()
+u32 Mmio::readTMCNTL(u32 address)
 {
-	u16 dispcnt = readU16(DISPCNT);
-	return dispcnt;
+	//Reading from timer counter/reload mmio returns the current counter value
+	//(or the recent/frozen counter value if the timer has stopped)
+	return tmc->getTimerCounter((eTimer)((address - TM0CNT_L) / 4));
 }
 
-u16 Mmio::readDISPSTAT()
+u32 Mmio::readTMCNTH(u32 address)
 {
-	u16 dispstat = readU16(DISPSTAT);
-	return dispstat;
+	return tmc->getTimerControlRegister((eTimer)((address - TM0CNT_H) / 4));
 }
 
-u16 Mmio::readBG0CNT()
+void Mmio::writeTMCNTL(const IoWrite& access)
 {
-	u16 bg0cnt = readU16(BG0CNT);
-	return bg0cnt;
+	//Writing to the timer counter/reload registers sets
+	//the reload value (does not actually affect the current counter value)
+	u8 timer = (access.address - TM0CNT_L) / 4;
+	LOG_TRACE(LogCategory::Timer, "write to tm%u cntl: 0x%04X", timer, access.value);
+	tmc->setTimerReload((eTimer)timer, access.value);
 }
 
-u16 Mmio::readBG0HOFS()
+void Mmio::writeTMCNTH(const IoWrite& access)
 {
-	u16 bg0hofs = readU16(BG0HOFS);
-	return bg0hofs;
+	u8 timer = (access.address - TM0CNT_H) / 4;
+	LOG_TRACE(LogCategory::Timer, "write to tm%u cnth: 0x%04X", timer, access.value);
+	tmc->setControl((eTimer)timer, access.value);
 }
 
-u16 Mmio::readBG0VOFS()
+u32 Mmio::readIE(u32 /*address*/)
 {
-	u16 bg0vofs = readU16(BG0VOFS);
-	return bg0vofs;
+	return interrupts.ie;
 }
 
-u16 Mmio::readBG1CNT()
+u32 Mmio::readIF(u32 /*address*/)
 {
-	u16 bg1cnt = readU16(BG1CNT);
-	return bg1cnt;
+	return interrupts.irqFlag;
 }
 
-u16 Mmio::readBG1HOFS()
+u32 Mmio::readIME(u32 /*address*/)
 {
-	u16 bg1hofs = readU16(BG1HOFS);
-	return bg1hofs;
+	return interrupts.ime;
 }
 
-u16 Mmio::readBG1VOFS()
+void Mmio::writeIE(const IoWrite& access)
 {
-	u16 bg1vofs = readU16(BG1VOFS);
-	return bg1vofs;
+	interrupts.writeIE(access.value);
 }
 
-u16 Mmio::readBG2CNT()
+void Mmio::writeIF(const IoWrite& access)
 {
-	u16 bg2cnt = readU16(BG2CNT);
-	return bg2cnt;
+	//Cpu writes to IF clears the bits written as 1
+	interrupts.acknowledge(access.written);
 }
 
-u16 Mmio::readBG2HOFS()
+void Mmio::writeIME(const IoWrite& access)
 {
-	u16 bg2hofs = readU16(BG2HOFS);
-	return bg2hofs;
+	interrupts.writeIME(access.value);
 }
 
-u16 Mmio::readBG2VOFS()
+void Mmio::writeHALTCNT(const IoWrite& access)
 {
-	u16 bg2vofs = readU16(BG2VOFS);
-	return bg2vofs;
+	LOG_TRACE(LogCategory::Io, "write to haltcnt: 0x%02X", access.written);
+	//Bit 7 clear halts until an interrupt, set is stop mode (not emulated)
+	u8 halt = (access.written >> 7) & 0x1;
+	if (halt == 0x0)
+		cpu->halt();
 }
 
-u16 Mmio::readBG3CNT()
+void Mmio::writeDMACNT(u32 address, u16 value)
 {
-	u16 bg3cnt = readU16(BG3CNT);
-	return bg3cnt;
+	writeU16(address, value);
 }
 
-u16 Mmio::readBG3HOFS()
+u16 Mmio::readDMACNT(u32 address)
 {
-	u16 bg3hofs = readU16(BG3HOFS);
-	return bg3hofs;
+	return loadIo(address - IO_START_ADDR, 2);
 }
 
-u16 Mmio::readBG3VOFS()
+u32 Mmio::readDMASource(u32 address)
 {
-	u16 bg3vofs = readU16(BG3VOFS);
-	return bg3vofs;
+	return loadIo(address - IO_START_ADDR, 4);
 }
 
-void Mmio::writeTMCNTL(u32 address, u16 value)
+u32 Mmio::readDMADest(u32 address)
 {
-	//Writing to the timer counter/reload registers sets
-	//the reload value (does not actually affect the mmio register/current counter value)
-	switch (address) {
-		case TM0CNT_L: tmc->setTimerReload(eTimer::TM0, value); break;
-		case TM1CNT_L: tmc->setTimerReload(eTimer::TM1, value); break;
-		case TM2CNT_L: tmc->setTimerReload(eTimer::TM2, value); break;
-		case TM3CNT_L: tmc->setTimerReload(eTimer::TM3, value); break;
-	}
+	return loadIo(address - IO_START_ADDR, 4);
 }
 
-void Mmio::writeTMCNTH(u32 address, u16 value)
+void Mmio::writeKEYINPUT(u16 value)
 {
-	switch (address) {
-		case TM0CNT_H: tmc->setControl(eTimer::TM0, value); break;
-		case TM1CNT_H: tmc->setControl(eTimer::TM1, value); break;
-		case TM2CNT_H: tmc->setControl(eTimer::TM2, value); break;
-		case TM3CNT_H: tmc->setControl(eTimer::TM3, value); break;
-	}
+	storeIo(KEYINPUT - IO_START_ADDR, value, 2);
 }
 
-u16 Mmio::readTMCNTH(u32 address)
+u16 Mmio::readIF()
 {
-	if (address == TM0CNT_H || address == TM1CNT_H
-		|| address == TM2CNT_H || address == TM3CNT_H) {
-		eTimer tm;
-		switch (address) {
-			case TM0CNT_H: tm = eTimer::TM0; break;
-			case TM1CNT_H: tm = eTimer::TM1; break;
-			case TM2CNT_H: tm = eTimer::TM2; break;
-			case TM3CNT_H: tm = eTimer::TM3; break;
-		}
-		return tmc->getTimerControlRegister(tm);
-	}
-	return 0;
+	return interrupts.irqFlag;
 }
 
-void Mmio::writeSOUNDBIAS(u32 value)
+u16 Mmio::readIE()
 {
-	u8 upper2, upper1;
-	u8 lower2, lower1;
-
-	lower1 = value & 0xFF;
-	lower2 = (value >> 8) & 0xFF;
-	upper1 = (value >> 16) & 0xFF;
-	upper2 = (value >> 24) & 0xFF;
-
-	u32 addr = SOUNDBIAS - IO_START_ADDR;
-	gm->io[addr] = lower1;
-	gm->io[addr + 1] = lower2;
-	gm->io[addr + 2] = upper1;
-	gm->io[addr + 3] = upper2;
+	return interrupts.ie;
 }
 
-u32 Mmio::readSOUNDBIAS()
+u32 Mmio::readIME()
 {
-	u32 soundbias = readU32(SOUNDBIAS);
-	return soundbias;
+	return interrupts.ime;
 }
-
-
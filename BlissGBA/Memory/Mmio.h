@@ -3,11 +3,48 @@
 #include "../Ppu/Lcd.h"
 #include "../Apu/Audio.h"
 #include "../Core/Keypad.h"
+#include "../Core/Interrupts.h"
 
 class GeneralMemory;
 struct DmaController;
 struct TimerController;
 class Arm;
+class Ppu;
+
+#define IO_REGISTERS 0x400 //one descriptor per io byte
+#define POSTFLG 0x4000300
+
+struct Mmio;
+
+/*
+	A cpu write to one io register, after splitting the access by register
+*/
+struct IoWrite {
+	u32 address; //start of the register
+	u32 value; //register value after the write (write mask applied)
+	u32 previous; //stored register value before the write (as last written)
+	u32 written; //the bytes the cpu wrote, unmasked (0 in the bytes it didn't)
+};
+
+using IoReadHandler = u32(Mmio::*)(u32 address);
+using IoWriteHandler = void(Mmio::*)(const IoWrite& write);
+
+/*
+	Describes the io register a byte belongs to. Every byte of a register
+	points at the same values, so an access of any width at any offset
+	resolves its register with one lookup.
+
+	Every write is stored in the io block, partial writes merge with it.
+	A read handler only answers cpu reads, registers without one read the
+	io block. The write handler runs after the new value has been stored
+*/
+struct IoRegister {
+	u8 width; //1, 2 or 4 bytes
+	u32 readMask; //bits the cpu reads back, write only bits read as 0
+	u32 writeMask; //bits the cpu can change
+	IoReadHandler read;
+	IoWriteHandler write;
+};
 
 struct Mmio {
 	Mmio(GeneralMemory *gm);
@@ -16,80 +53,67 @@ struct Mmio {
 	void connect(DmaController* dmac);
 	void connect(TimerController* tmc);
 	void connect(Arm* cpu);
+	void connect(Ppu* ppu);
+
+	void buildRegisterTable();
+	void defineRegister(u32 address, u8 width, u32 readMask, u32 writeMask,
+		IoReadHandler read = nullptr, IoWriteHandler write = nullptr);
 
-	void writeU8(u32 address, u8 value); //used internally
+	//Cpu accesses, split into the registers they touch
+	void writeU8(u32 address, u8 value);
 	void writeU16(u32 address, u16 value);
 	void writeU32(u32 address, u32 value);
+	void write(u32 address, u32 value, u8 size);
+	void writeRegister(u32 offset, u32 written, u32 bytes);
 
 	u8 readU8(u32 absoluteAddress);
 	u16 readU16(u32 absoluteAddress);
 	u32 readU32(u32 absoluteAddress);
+	u32 read(u32 absoluteAddress, u8 size);
+	u32 readRegister(u32 offset);
+
+	//Raw io block storage, no masks or side effects
+	u32 loadIo(u32 offset, u8 width);
+	void storeIo(u32 offset, u32 value, u8 width);
+
+	//Register handlers
+	u32 readDISPSTAT(u32 address);
+	u32 readVCOUNT(u32 address);
+	void writeDISPSTAT(const IoWrite& write);
+	void writeBGReference(const IoWrite& write);
+	void writeDMACNT(const IoWrite& write);
+	u32 readTMCNTL(u32 address);
+	u32 readTMCNTH(u32 address);
+	void writeTMCNTL(const IoWrite& write);
+	void writeTMCNTH(const IoWrite& write);
+	u32 readIE(u32 address);
+	u32 readIF(u32 address);
+	u32 readIME(u32 address);
+	void writeIE(const IoWrite& write);
+	void writeIF(const IoWrite& write);
+	void writeIME(const IoWrite& write);
+	void writeHALTCNT(const IoWrite& write);
 
-	//Dma
-	void writeDMASource(u32 address, u32 value);
-	void writeDMADest(u32 address, u32 value);
+	//Dma (internal, reads the io block directly)
 	void writeDMACNT(u32 address, u16 value);
-	void writeDMACNT(u32 address, u32 value);
 	u16 readDMACNT(u32 address);
 	u32 readDMASource(u32 address);
 	u32 readDMADest(u32 address);
 
 	//Keypad
 	void writeKEYINPUT(u16 value);
-	void writeKEYCNT(u16 value);
 
 	//Interrupts/System Control
-	void writeIF(u16 value);
-	void writeIE(u16 value);
-	void writeIME(u32 value);
 	u16 readIF();
 	u16 readIE();
 	u32 readIME();
 
-	void writeHALTCNT(u8 value);
-
-	//Lcd
-	void writeDISPCNT(u16 value);
-	void writeDISPSTAT(u16 value);
-	void writeVCOUNT(u16 value);
-	void writeBG0CNT(u16 value);
-	void writeBG0HOFS(u16 value);
-	void writeBG0VOFS(u16 value);
-	void writeBG1CNT(u16 value);
-	void writeBG1HOFS(u16 value);
-	void writeBG1VOFS(u16 value);
-	void writeBG2CNT(u16 value);
-	void writeBG2HOFS(u16 value);
-	void writeBG2VOFS(u16 value);
-	void writeBG3CNT(u16 value);
-	void writeBG3HOFS(u16 value);
-	void writeBG3VOFS(u16 value);
-	u16 readDISPCNT();
-	u16 readDISPSTAT();
-	u16 readBG0CNT();
-	u16 readBG0HOFS();
-	u16 readBG0VOFS();
-	u16 readBG1CNT();
-	u16 readBG1HOFS();
-	u16 readBG1VOFS();
-	u16 readBG2CNT();
-	u16 readBG2HOFS();
-	u16 readBG2VOFS();
-	u16 readBG3CNT();
-	u16 readBG3HOFS();
-	u16 readBG3VOFS();
-
-	//Timers
-	void writeTMCNTL(u32 address, u16 value);
-	void writeTMCNTH(u32 address, u16 value);
-	u16 readTMCNTH(u32 address);
-
-	//Apu
-	void writeSOUNDBIAS(u32 value);
-	u32 readSOUNDBIAS();
+	InterruptController interrupts;
+	IoRegister registers[IO_REGISTERS];
 
 	GeneralMemory* gm;
 	DmaController* dmac = nullptr;
 	TimerController* tmc = nullptr;
 	Arm* cpu = nullptr;
-};
\ No newline at end of file
+	Ppu* ppu = nullptr;
+};
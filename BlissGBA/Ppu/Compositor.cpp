@@ -0,0 +1,188 @@
+#include "Compositor.h"
+#include "Sprites.h"
+
+Compositor::Compositor(const ScanlineKernels* kernels)
+	:kernels(kernels)
+{
+
+}
+
+void Compositor::compose(const CompositorRegs& regs, u16 line, u8 bgMask, const u8* bgPriority,
+	const u32 (*bgLines)[SCREEN_WIDTH], const ObjRenderer* objs, u32 backdrop, u32* out)
+{
+	bool windows = (regs.dispcnt >> 13) & 0x7;
+	BlendMode mode = (BlendMode)((regs.bldcnt >> 6) & 0x3);
+
+	//Nothing can blend without a mode, except semi transparent objs
+	bool semi_objs = false;
+	if (objs) {
+		for (u32 x = 0; x < SCREEN_WIDTH; x++)
+			semi_objs |= (objs->semiTransparent[x] != 0);
+	}
+
+	//Plain priority merge when no window or effect is active
+	if (!windows && mode == BlendMode::None && !semi_objs) {
+		std::fill(out, out + SCREEN_WIDTH, TRANSPARENT_PIXEL);
+		for (u8 priority = 0; priority < 4; priority++) {
+			if (objs)
+				kernels->mergeLayer(out, objs->layers[priority], SCREEN_WIDTH);
+
+			for (u8 bg = 0; bg < 4; bg++) {
+				if (((bgMask >> bg) & 0x1) && bgPriority[bg] == priority)
+					kernels->mergeLayer(out, bgLines[bg], SCREEN_WIDTH);
+			}
+		}
+		kernels->fillTransparent(out, backdrop, SCREEN_WIDTH);
+		return;
+	}
+
+	buildWindowMask(regs, line, objs);
+	std::fill(topLayer, topLayer + SCREEN_WIDTH, LAYER_NONE);
+	std::fill(bottomLayer, bottomLayer + SCREEN_WIDTH, LAYER_NONE);
+
+	//Objs are in front of bgs with the same priority, on equal priority
+	//the lower numbered bg is drawn on top
+	for (u8 priority = 0; priority < 4; priority++) {
+		if (objs)
+			mergeLayer(objs->layers[priority], LAYER_OBJ);
+
+		for (u8 bg = 0; bg < 4; bg++) {
+			if (((bgMask >> bg) & 0x1) && bgPriority[bg] == priority)
+				mergeLayer(bgLines[bg], bg);
+		}
+	}
+
+	//The backdrop is behind everything and can't be windowed out
+	for (u32 x = 0; x < SCREEN_WIDTH; x++) {
+		bool to_top = topLayer[x] == LAYER_NONE;
+		bool to_bottom = !to_top && bottomLayer[x] == LAYER_NONE;
+		top[x] = to_top ? backdrop : top[x];
+		topLayer[x] = to_top ? LAYER_BACKDROP : topLayer[x];
+		bottom[x] = to_bottom ? backdrop : bottom[x];
+		bottomLayer[x] = to_bottom ? LAYER_BACKDROP : bottomLayer[x];
+	}
+
+	applyEffects(regs, objs, out);
+}
+
+void Compositor::buildWindowMask(const CompositorRegs& regs, u16 line, const ObjRenderer* objs)
+{
+	bool win0 = (regs.dispcnt >> 13) & 0x1;
+	bool win1 = (regs.dispcnt >> 14) & 0x1;
+	bool obj_win = ((regs.dispcnt >> 15) & 0x1) && objs;
+
+	if (!win0 && !win1 && !obj_win) {
+		std::fill(windowMask, windowMask + SCREEN_WIDTH, WINDOW_ALL_LAYERS);
+		return;
+	}
+
+	//Outside of every window, then each window on top of the lower priority ones
+	std::fill(windowMask, windowMask + SCREEN_WIDTH, regs.winOut & WINDOW_ALL_LAYERS);
+
+	if (obj_win) {
+		u8 layers = (regs.winOut >> 8) & WINDOW_ALL_LAYERS;
+		for (u32 x = 0; x < SCREEN_WIDTH; x++)
+			windowMask[x] = objs->window[x] ? layers : windowMask[x];
+	}
+
+	for (s32 win = 1; win >= 0; win--) {
+		if (!((regs.dispcnt >> (13 + win)) & 0x1))
+			continue;
+
+		//Garbage values of Y2 > 160 or Y1 > Y2 are treated as Y2 = 160
+		u8 y1 = regs.winV[win] >> 8;
+		u8 y2 = regs.winV[win] & 0xFF;
+		if (y2 > SCREEN_HEIGHT || y1 > y2) y2 = SCREEN_HEIGHT;
+		if (line < y1 || line >= y2)
+			continue;
+
+		u8 shift = (win == 0) ? 0 : 8;
+		fillWindowSpan(regs.winH[win], (regs.winIn >> shift) & WINDOW_ALL_LAYERS);
+	}
+}
+
+void Compositor::fillWindowSpan(u16 winH, u8 layers)
+{
+	//Garbage values of X2 > 240 or X1 > X2 are treated as X2 = 240
+	u8 x1 = winH >> 8;
+	u8 x2 = winH & 0xFF;
+	if (x2 > SCREEN_WIDTH || x1 > x2) x2 = SCREEN_WIDTH;
+	if (x1 < x2)
+		std::fill(windowMask + x1, windowMask + x2, layers);
+}
+
+void Compositor::mergeLayer(const u32* colors, u8 layer)
+{
+	//First visible layer goes on top, the second one is kept for blending
+	u8 bit = 1 << layer;
+	for (u32 x = 0; x < SCREEN_WIDTH; x++) {
+		bool visible = (colors[x] != TRANSPARENT_PIXEL) && (windowMask[x] & bit);
+		bool to_top = visible && topLayer[x] == LAYER_NONE;
+		bool to_bottom = visible && !to_top && bottomLayer[x] == LAYER_NONE;
+		top[x] = to_top ? colors[x] : top[x];
+		topLayer[x] = to_top ? layer : topLayer[x];
+		bottom[x] = to_bottom ? colors[x] : bottom[x];
+		bottomLayer[x] = to_bottom ? layer : bottomLayer[x];
+	}
+}
+
+void Compositor::applyEffects(const CompositorRegs& regs, const ObjRenderer* objs, u32* out)
+{
+	BlendMode mode = (BlendMode)((regs.bldcnt >> 6) & 0x3);
+	u8 first_targets = regs.bldcnt & 0x3F;
+	u8 second_targets = (regs.bldcnt >> 8) & 0x3F;
+
+	bool any_alpha = false, any_fade = false;
+	for (u32 x = 0; x < SCREEN_WIDTH; x++) {
+		bool first = (first_targets >> topLayer[x]) & 0x1;
+		bool second = (second_targets >> bottomLayer[x]) & 0x1;
+		bool effects = (windowMask[x] >> WINDOW_EFFECTS_BIT) & 0x1;
+		bool semi = objs && topLayer[x] == LAYER_OBJ && objs->semiTransparent[x];
+
+		//Semi transparent objs alpha blend with a second target regardless of
+		//the mode, the first target bits and the window effect bit
+		BlendMode op = BlendMode::None;
+		if (semi && second)
+			op = BlendMode::Alpha;
+		else if (effects && first) {
+			if (mode == BlendMode::Alpha)
+				op = second ? BlendMode::Alpha : BlendMode::None;
+			else
+				op = mode;
+		}
+		effect[x] = (u8)op;
+		any_alpha |= (op == BlendMode::Alpha);
+		any_fade |= (op == BlendMode::Brighten || op == BlendMode::Darken);
+	}
+
+	//Coefficients are 1/16ths, anything above 16 acts as 16
+	if (any_alpha) {
+		u8 eva = std::min(regs.bldalpha & 0x1F, 16);
+		u8 evb = std::min((regs.bldalpha >> 8) & 0x1F, 16);
+		kernels->alphaBlend(blended, top, bottom, eva, evb, SCREEN_WIDTH);
+	}
+	if (any_fade) {
+		u8 evy = std::min(regs.bldy & 0x1F, 16);
+		if (mode == BlendMode::Brighten)
+			kernels->brighten(faded, top, evy, SCREEN_WIDTH);
+		else
+			kernels->darken(faded, top, evy, SCREEN_WIDTH);
+	}
+
+	for (u32 x = 0; x < SCREEN_WIDTH; x++) {
+		u8 op = effect[x];
+		u32 color = (op == (u8)BlendMode::Alpha) ? blended[x] : top[x];
+		out[x] = (op == (u8)BlendMode::Brighten || op == (u8)BlendMode::Darken) ? faded[x] : color;
+	}
+}
+
+void Compositor::applyMosaic(u32* line, u8 size)
+{
+	if (size <= 1)
+		return;
+
+	for (u32 x = 0; x < SCREEN_WIDTH; x += size) {
+		u32 end = std::min<u32>(x + size, SCREEN_WIDTH);
+		std::fill(line + x + 1, line + end, line[x]);
+	}
+}
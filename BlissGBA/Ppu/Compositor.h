@@ -0,0 +1,66 @@
+#pragma once
+#include "../Utils/Utils.h"
+#include "FrameBuffer.h"
+#include "Kernels.h"
+
+struct ObjRenderer;
+
+//Layer numbers as used by the window and blend registers
+#define LAYER_OBJ 4
+#define LAYER_BACKDROP 5
+#define LAYER_NONE 6
+#define WINDOW_EFFECTS_BIT 5
+#define WINDOW_ALL_LAYERS 0x3F //bg 0 - 3, obj and effects
+
+enum class BlendMode : u8 {
+	None = 0,
+	Alpha,
+	Brighten,
+	Darken
+};
+
+/*
+	Registers the compositor reads, captured once per line
+*/
+struct CompositorRegs {
+	u16 dispcnt;
+	u16 winH[2];
+	u16 winV[2];
+	u16 winIn;
+	u16 winOut;
+	u16 bldcnt;
+	u16 bldalpha;
+	u16 bldy;
+};
+
+/*
+	Combines the bg and obj line buffers into the final line.
+
+	Windows are turned into spans once per line and written into a per pixel
+	layer mask with plain fills. Layers are merged front to back into a top and a
+	bottom buffer (the two candidates for blending) with branch free loops, then
+	the blend kernels run over whole lines and each pixel picks its result.
+*/
+struct Compositor {
+	Compositor(const ScanlineKernels* kernels);
+	void compose(const CompositorRegs& regs, u16 line, u8 bgMask, const u8* bgPriority,
+		const u32 (*bgLines)[SCREEN_WIDTH], const ObjRenderer* objs, u32 backdrop, u32* out);
+	//Repeats every size'th pixel across the next size - 1 pixels
+	static void applyMosaic(u32* line, u8 size);
+
+	void buildWindowMask(const CompositorRegs& regs, u16 line, const ObjRenderer* objs);
+	void fillWindowSpan(u16 winH, u8 layers);
+	void mergeLayer(const u32* colors, u8 layer);
+	void applyEffects(const CompositorRegs& regs, const ObjRenderer* objs, u32* out);
+
+	u8 windowMask[SCREEN_WIDTH]; //layers (and effects) enabled at each pixel
+	u32 top[SCREEN_WIDTH];
+	u32 bottom[SCREEN_WIDTH];
+	u8 topLayer[SCREEN_WIDTH];
+	u8 bottomLayer[SCREEN_WIDTH];
+	u8 effect[SCREEN_WIDTH]; //BlendMode to use per pixel
+	u32 blended[SCREEN_WIDTH];
+	u32 faded[SCREEN_WIDTH];
+
+	const ScanlineKernels* kernels;
+};
@@ -0,0 +1,49 @@
+#include "FrameBuffer.h"
+
+FrameBuffer::FrameBuffer()
+	:handler(nullptr), handlerUser(nullptr)
+{
+	clear();
+}
+
+void FrameBuffer::clear()
+{
+	//Opaque black
+	std::fill(&buffers[0][0], &buffers[0][0] + (2 * FRAME_PIXELS), 0xFF000000);
+	back = 0;
+	frameHash = 0;
+	frameNumber = 0;
+	unchanged = false;
+}
+
+void FrameBuffer::swap(bool changed)
+{
+	back ^= 1;
+	frameNumber++;
+
+	//Every line was copied from the previous frame, so is its hash
+	unchanged = !changed;
+	if (unchanged) {
+		if (handler)
+			handler(getFrontBuffer(), frameNumber, handlerUser);
+		return;
+	}
+
+	//FNV-1a over whole pixels, good enough to tell frames apart
+	const u32* front = getFrontBuffer();
+	u64 hash = 0xCBF29CE484222325;
+	for (u32 i = 0; i < FRAME_PIXELS; i++) {
+		hash ^= front[i];
+		hash *= 0x100000001B3;
+	}
+	frameHash = hash;
+
+	if (handler)
+		handler(front, frameNumber, handlerUser);
+}
+
+void FrameBuffer::setFrameHandler(FrameHandler handler, void* user)
+{
+	this->handler = handler;
+	this->handlerUser = user;
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "../Utils/Utils.h"
+
+#define SCREEN_WIDTH 240
+#define SCREEN_HEIGHT 160
+#define FRAME_PIXELS (SCREEN_WIDTH * SCREEN_HEIGHT)
+
+//Line buffer pixels are RGBA8888 (r in the lowest byte, matching sf::Image),
+//alpha == 0 marks a transparent layer pixel
+#define TRANSPARENT_PIXEL 0x00000000
+
+//Called with the front buffer when a frame completes, the pointer stays
+//valid (and unchanged) until the next frame completes
+using FrameHandler = void(*)(const u32* pixels, u64 frameNumber, void* user);
+
+/*
+	Two RGBA8888 frames (r in the lowest byte, sf::Texture::update compatible).
+	The ppu draws lines into the back buffer, at vblank the buffers are swapped and
+	the finished frame is hashed so presenters can skip uploading identical frames.
+	When the ppu knows no line changed the hash is carried over instead
+*/
+struct FrameBuffer {
+	FrameBuffer();
+	void clear();
+	void swap(bool changed);
+	void setFrameHandler(FrameHandler handler, void* user);
+
+	inline u32* getBackLine(u16 y) { return &buffers[back][y * SCREEN_WIDTH]; }
+	inline const u32* getFrontBuffer() const { return buffers[back ^ 1]; }
+
+	u32 buffers[2][FRAME_PIXELS];
+	u8 back;
+	u64 frameHash; //hash of the front buffer
+	u64 frameNumber;
+	bool unchanged; //the front buffer is identical to the frame before it
+
+	FrameHandler handler;
+	void* handlerUser;
+};
@@ -0,0 +1,514 @@
+#include "Kernels.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#if SIMD_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_AVX2
+#else
+#include <cpuid.h>
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#include <immintrin.h>
+#endif
+
+#define OPAQUE_ALPHA 0xFF000000
+
+/*
+	Scalar
+*/
+static inline u8 expand5(u8 c) { return (c << 3) | (c >> 2); }
+
+static void convertBgr555Scalar(const u16* src, u32* dst, u32 count)
+{
+	for (u32 i = 0; i < count; i++) {
+		u16 c = src[i];
+		dst[i] = OPAQUE_ALPHA | (expand5((c >> 10) & 0x1F) << 16)
+			| (expand5((c >> 5) & 0x1F) << 8) | expand5(c & 0x1F);
+	}
+}
+
+static void unpack4bppScalar(const u8* src, u8* dst, u32 bytes)
+{
+	for (u32 i = 0; i < bytes; i++) {
+		dst[i * 2] = src[i] & 0xF;
+		dst[i * 2 + 1] = (src[i] >> 4) & 0xF;
+	}
+}
+
+static void mergeLayerScalar(u32* dst, const u32* layer, u32 count)
+{
+	for (u32 i = 0; i < count; i++) {
+		if (dst[i] == 0)
+			dst[i] = layer[i];
+	}
+}
+
+static void fillTransparentScalar(u32* dst, u32 color, u32 count)
+{
+	for (u32 i = 0; i < count; i++) {
+		if (dst[i] == 0)
+			dst[i] = color;
+	}
+}
+
+static void alphaBlendScalar(u32* dst, const u32* top, const u32* bottom, u8 eva, u8 evb, u32 count)
+{
+	for (u32 i = 0; i < count; i++) {
+		u32 out = OPAQUE_ALPHA;
+		for (u32 shift = 0; shift < 24; shift += 8) {
+			u32 a = (top[i] >> shift) & 0xFF;
+			u32 b = (bottom[i] >> shift) & 0xFF;
+			out |= std::min<u32>(255, (a * eva + b * evb) >> 4) << shift;
+		}
+		dst[i] = out;
+	}
+}
+
+static void brightenScalar(u32* dst, const u32* src, u8 evy, u32 count)
+{
+	for (u32 i = 0; i < count; i++) {
+		u32 out = OPAQUE_ALPHA;
+		for (u32 shift = 0; shift < 24; shift += 8) {
+			u32 c = (src[i] >> shift) & 0xFF;
+			out |= (c + (((255 - c) * evy) >> 4)) << shift;
+		}
+		dst[i] = out;
+	}
+}
+
+static void darkenScalar(u32* dst, const u32* src, u8 evy, u32 count)
+{
+	for (u32 i = 0; i < count; i++) {
+		u32 out = OPAQUE_ALPHA;
+		for (u32 shift = 0; shift < 24; shift += 8) {
+			u32 c = (src[i] >> shift) & 0xFF;
+			out |= (c - ((c * evy) >> 4)) << shift;
+		}
+		dst[i] = out;
+	}
+}
+
+#if SIMD_X86
+/*
+	SSE2, 4 pixels (8 colors / 16 bytes) per iteration, tails go to the scalar path
+*/
+static inline __m128i expand5Sse2(__m128i c)
+{
+	return _mm_or_si128(_mm_slli_epi16(c, 3), _mm_srli_epi16(c, 2));
+}
+
+static void convertBgr555Sse2(const u16* src, u32* dst, u32 count)
+{
+	const __m128i mask5 = _mm_set1_epi16(0x1F);
+	const __m128i alpha = _mm_set1_epi16((s16)0xFF00);
+	u32 i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m128i c = _mm_loadu_si128((const __m128i*)&src[i]);
+		__m128i r = expand5Sse2(_mm_and_si128(c, mask5));
+		__m128i g = expand5Sse2(_mm_and_si128(_mm_srli_epi16(c, 5), mask5));
+		__m128i b = expand5Sse2(_mm_and_si128(_mm_srli_epi16(c, 10), mask5));
+		__m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+		__m128i ba = _mm_or_si128(b, alpha);
+		_mm_storeu_si128((__m128i*)&dst[i], _mm_unpacklo_epi16(rg, ba));
+		_mm_storeu_si128((__m128i*)&dst[i + 4], _mm_unpackhi_epi16(rg, ba));
+	}
+	convertBgr555Scalar(src + i, dst + i, count - i);
+}
+
+static void unpack4bppSse2(const u8* src, u8* dst, u32 bytes)
+{
+	const __m128i mask4 = _mm_set1_epi8(0xF);
+	u32 i = 0;
+	for (; i + 16 <= bytes; i += 16) {
+		__m128i b = _mm_loadu_si128((const __m128i*)&src[i]);
+		__m128i lo = _mm_and_si128(b, mask4);
+		__m128i hi = _mm_and_si128(_mm_srli_epi16(b, 4), mask4);
+		_mm_storeu_si128((__m128i*)&dst[i * 2], _mm_unpacklo_epi8(lo, hi));
+		_mm_storeu_si128((__m128i*)&dst[i * 2 + 16], _mm_unpackhi_epi8(lo, hi));
+	}
+	unpack4bppScalar(src + i, dst + i * 2, bytes - i);
+}
+
+static void mergeLayerSse2(u32* dst, const u32* layer, u32 count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	u32 i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i d = _mm_loadu_si128((const __m128i*)&dst[i]);
+		__m128i l = _mm_loadu_si128((const __m128i*)&layer[i]);
+		//transparent dst pixels are 0 so or'ing in the masked layer is a select
+		__m128i empty = _mm_cmpeq_epi32(d, zero);
+		_mm_storeu_si128((__m128i*)&dst[i], _mm_or_si128(d, _mm_and_si128(l, empty)));
+	}
+	mergeLayerScalar(dst + i, layer + i, count - i);
+}
+
+static void fillTransparentSse2(u32* dst, u32 color, u32 count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i c = _mm_set1_epi32(color);
+	u32 i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i d = _mm_loadu_si128((const __m128i*)&dst[i]);
+		__m128i empty = _mm_cmpeq_epi32(d, zero);
+		_mm_storeu_si128((__m128i*)&dst[i], _mm_or_si128(d, _mm_and_si128(c, empty)));
+	}
+	fillTransparentScalar(dst + i, color, count - i);
+}
+
+static void alphaBlendSse2(u32* dst, const u32* top, const u32* bottom, u8 eva, u8 evb, u32 count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alpha = _mm_set1_epi32(OPAQUE_ALPHA);
+	const __m128i va = _mm_set1_epi16(eva);
+	const __m128i vb = _mm_set1_epi16(evb);
+	u32 i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i t = _mm_loadu_si128((const __m128i*)&top[i]);
+		__m128i b = _mm_loadu_si128((const __m128i*)&bottom[i]);
+		//255 * 16 * 2 fits in 16 bits, packus clamps the result to 255
+		__m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(t, zero), va),
+			_mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), vb));
+		__m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(t, zero), va),
+			_mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), vb));
+		__m128i out = _mm_packus_epi16(_mm_srli_epi16(lo, 4), _mm_srli_epi16(hi, 4));
+		_mm_storeu_si128((__m128i*)&dst[i], _mm_or_si128(out, alpha));
+	}
+	alphaBlendScalar(dst + i, top + i, bottom + i, eva, evb, count - i);
+}
+
+static void brightenSse2(u32* dst, const u32* src, u8 evy, u32 count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alpha = _mm_set1_epi32(OPAQUE_ALPHA);
+	const __m128i white = _mm_set1_epi16(255);
+	const __m128i vy = _mm_set1_epi16(evy);
+	u32 i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i s = _mm_loadu_si128((const __m128i*)&src[i]);
+		__m128i lo = _mm_unpacklo_epi8(s, zero);
+		__m128i hi = _mm_unpackhi_epi8(s, zero);
+		lo = _mm_add_epi16(lo, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(white, lo), vy), 4));
+		hi = _mm_add_epi16(hi, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(white, hi), vy), 4));
+		_mm_storeu_si128((__m128i*)&dst[i], _mm_or_si128(_mm_packus_epi16(lo, hi), alpha));
+	}
+	brightenScalar(dst + i, src + i, evy, count - i);
+}
+
+static void darkenSse2(u32* dst, const u32* src, u8 evy, u32 count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alpha = _mm_set1_epi32(OPAQUE_ALPHA);
+	const __m128i vy = _mm_set1_epi16(evy);
+	u32 i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i s = _mm_loadu_si128((const __m128i*)&src[i]);
+		__m128i lo = _mm_unpacklo_epi8(s, zero);
+		__m128i hi = _mm_unpackhi_epi8(s, zero);
+		lo = _mm_sub_epi16(lo, _mm_srli_epi16(_mm_mullo_epi16(lo, vy), 4));
+		hi = _mm_sub_epi16(hi, _mm_srli_epi16(_mm_mullo_epi16(hi, vy), 4));
+		_mm_storeu_si128((__m128i*)&dst[i], _mm_or_si128(_mm_packus_epi16(lo, hi), alpha));
+	}
+	darkenScalar(dst + i, src + i, evy, count - i);
+}
+
+/*
+	AVX2, twice the width of SSE2. unpack works per 128 bit lane so
+	results are put back in order with permute2x128
+*/
+TARGET_AVX2 static inline __m256i expand5Avx2(__m256i c)
+{
+	return _mm256_or_si256(_mm256_slli_epi16(c, 3), _mm256_srli_epi16(c, 2));
+}
+
+TARGET_AVX2 static void convertBgr555Avx2(const u16* src, u32* dst, u32 count)
+{
+	const __m256i mask5 = _mm256_set1_epi16(0x1F);
+	const __m256i alpha = _mm256_set1_epi16((s16)0xFF00);
+	u32 i = 0;
+	for (; i + 16 <= count; i += 16) {
+		__m256i c = _mm256_loadu_si256((const __m256i*)&src[i]);
+		__m256i r = expand5Avx2(_mm256_and_si256(c, mask5));
+		__m256i g = expand5Avx2(_mm256_and_si256(_mm256_srli_epi16(c, 5), mask5));
+		__m256i b = expand5Avx2(_mm256_and_si256(_mm256_srli_epi16(c, 10), mask5));
+		__m256i rg = _mm256_or_si256(r, _mm256_slli_epi16(g, 8));
+		__m256i ba = _mm256_or_si256(b, alpha);
+		__m256i lo = _mm256_unpacklo_epi16(rg, ba);
+		__m256i hi = _mm256_unpackhi_epi16(rg, ba);
+		_mm256_storeu_si256((__m256i*)&dst[i], _mm256_permute2x128_si256(lo, hi, 0x20));
+		_mm256_storeu_si256((__m256i*)&dst[i + 8], _mm256_permute2x128_si256(lo, hi, 0x31));
+	}
+	//avoid the avx -> sse transition penalty
+	_mm256_zeroupper();
+	convertBgr555Sse2(src + i, dst + i, count - i);
+}
+
+TARGET_AVX2 static void unpack4bppAvx2(const u8* src, u8* dst, u32 bytes)
+{
+	const __m256i mask4 = _mm256_set1_epi8(0xF);
+	u32 i = 0;
+	for (; i + 32 <= bytes; i += 32) {
+		__m256i b = _mm256_loadu_si256((const __m256i*)&src[i]);
+		__m256i lo = _mm256_and_si256(b, mask4);
+		__m256i hi = _mm256_and_si256(_mm256_srli_epi16(b, 4), mask4);
+		__m256i first = _mm256_unpacklo_epi8(lo, hi);
+		__m256i second = _mm256_unpackhi_epi8(lo, hi);
+		_mm256_storeu_si256((__m256i*)&dst[i * 2], _mm256_permute2x128_si256(first, second, 0x20));
+		_mm256_storeu_si256((__m256i*)&dst[i * 2 + 32], _mm256_permute2x128_si256(first, second, 0x31));
+	}
+	//avoid the avx -> sse transition penalty
+	_mm256_zeroupper();
+	unpack4bppSse2(src + i, dst + i * 2, bytes - i);
+}
+
+TARGET_AVX2 static void mergeLayerAvx2(u32* dst, const u32* layer, u32 count)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	u32 i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i d = _mm256_loadu_si256((const __m256i*)&dst[i]);
+		__m256i l = _mm256_loadu_si256((const __m256i*)&layer[i]);
+		__m256i empty = _mm256_cmpeq_epi32(d, zero);
+		_mm256_storeu_si256((__m256i*)&dst[i], _mm256_or_si256(d, _mm256_and_si256(l, empty)));
+	}
+	//avoid the avx -> sse transition penalty
+	_mm256_zeroupper();
+	mergeLayerSse2(dst + i, layer + i, count - i);
+}
+
+TARGET_AVX2 static void fillTransparentAvx2(u32* dst, u32 color, u32 count)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i c = _mm256_set1_epi32(color);
+	u32 i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i d = _mm256_loadu_si256((const __m256i*)&dst[i]);
+		__m256i empty = _mm256_cmpeq_epi32(d, zero);
+		_mm256_storeu_si256((__m256i*)&dst[i], _mm256_or_si256(d, _mm256_and_si256(c, empty)));
+	}
+	//avoid the avx -> sse transition penalty
+	_mm256_zeroupper();
+	fillTransparentSse2(dst + i, color, count - i);
+}
+
+TARGET_AVX2 static void alphaBlendAvx2(u32* dst, const u32* top, const u32* bottom, u8 eva, u8 evb, u32 count)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i alpha = _mm256_set1_epi32(OPAQUE_ALPHA);
+	const __m256i va = _mm256_set1_epi16(eva);
+	const __m256i vb = _mm256_set1_epi16(evb);
+	u32 i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i t = _mm256_loadu_si256((const __m256i*)&top[i]);
+		__m256i b = _mm256_loadu_si256((const __m256i*)&bottom[i]);
+		//unpack and pack are both per lane so the pixel order survives
+		__m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(t, zero), va),
+			_mm256_mullo_epi16(_mm256_unpacklo_epi8(b, zero), vb));
+		__m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(t, zero), va),
+			_mm256_mullo_epi16(_mm256_unpackhi_epi8(b, zero), vb));
+		__m256i out = _mm256_packus_epi16(_mm256_srli_epi16(lo, 4), _mm256_srli_epi16(hi, 4));
+		_mm256_storeu_si256((__m256i*)&dst[i], _mm256_or_si256(out, alpha));
+	}
+	//avoid the avx -> sse transition penalty
+	_mm256_zeroupper();
+	alphaBlendSse2(dst + i, top + i, bottom + i, eva, evb, count - i);
+}
+
+TARGET_AVX2 static void brightenAvx2(u32* dst, const u32* src, u8 evy, u32 count)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i alpha = _mm256_set1_epi32(OPAQUE_ALPHA);
+	const __m256i white = _mm256_set1_epi16(255);
+	const __m256i vy = _mm256_set1_epi16(evy);
+	u32 i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i s = _mm256_loadu_si256((const __m256i*)&src[i]);
+		__m256i lo = _mm256_unpacklo_epi8(s, zero);
+		__m256i hi = _mm256_unpackhi_epi8(s, zero);
+		lo = _mm256_add_epi16(lo, _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(white, lo), vy), 4));
+		hi = _mm256_add_epi16(hi, _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(white, hi), vy), 4));
+		_mm256_storeu_si256((__m256i*)&dst[i], _mm256_or_si256(_mm256_packus_epi16(lo, hi), alpha));
+	}
+	//avoid the avx -> sse transition penalty
+	_mm256_zeroupper();
+	brightenSse2(dst + i, src + i, evy, count - i);
+}
+
+TARGET_AVX2 static void darkenAvx2(u32* dst, const u32* src, u8 evy, u32 count)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i alpha = _mm256_set1_epi32(OPAQUE_ALPHA);
+	const __m256i vy = _mm256_set1_epi16(evy);
+	u32 i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i s = _mm256_loadu_si256((const __m256i*)&src[i]);
+		__m256i lo = _mm256_unpacklo_epi8(s, zero);
+		__m256i hi = _mm256_unpackhi_epi8(s, zero);
+		lo = _mm256_sub_epi16(lo, _mm256_srli_epi16(_mm256_mullo_epi16(lo, vy), 4));
+		hi = _mm256_sub_epi16(hi, _mm256_srli_epi16(_mm256_mullo_epi16(hi, vy), 4));
+		_mm256_storeu_si256((__m256i*)&dst[i], _mm256_or_si256(_mm256_packus_epi16(lo, hi), alpha));
+	}
+	//avoid the avx -> sse transition penalty
+	_mm256_zeroupper();
+	darkenSse2(dst + i, src + i, evy, count - i);
+}
+#endif
+
+static const ScanlineKernels scalarKernels = {
+	SimdLevel::Scalar, convertBgr555Scalar, unpack4bppScalar, mergeLayerScalar,
+	fillTransparentScalar, alphaBlendScalar, brightenScalar, darkenScalar
+};
+
+#if SIMD_X86
+static const ScanlineKernels sse2Kernels = {
+	SimdLevel::SSE2, convertBgr555Sse2, unpack4bppSse2, mergeLayerSse2,
+	fillTransparentSse2, alphaBlendSse2, brightenSse2, darkenSse2
+};
+
+static const ScanlineKernels avx2Kernels = {
+	SimdLevel::AVX2, convertBgr555Avx2, unpack4bppAvx2, mergeLayerAvx2,
+	fillTransparentAvx2, alphaBlendAvx2, brightenAvx2, darkenAvx2
+};
+#endif
+
+SimdLevel detectSimdLevel()
+{
+#if SIMD_X86
+	u32 regs[4] = {};
+	bool sse2 = false, avx2 = false;
+#ifdef _MSC_VER
+	__cpuid((int*)regs, 0);
+	u32 maxLeaf = regs[0];
+	__cpuid((int*)regs, 1);
+#else
+	u32 maxLeaf = __get_cpuid_max(0, nullptr);
+	__cpuid(1, regs[0], regs[1], regs[2], regs[3]);
+#endif
+	sse2 = testBit(regs[3], 26);
+	//the os has to save the ymm registers too (osxsave + xcr0 bits 1,2)
+	bool osAvx = testBit(regs[2], 27) && testBit(regs[2], 28);
+	if (osAvx && maxLeaf >= 7) {
+#ifdef _MSC_VER
+		u64 xcr0 = _xgetbv(0);
+		__cpuidex((int*)regs, 7, 0);
+#else
+		u32 xcr0Lo, xcr0Hi;
+		__asm__ volatile("xgetbv" : "=a"(xcr0Lo), "=d"(xcr0Hi) : "c"(0));
+		u64 xcr0 = ((u64)xcr0Hi << 32) | xcr0Lo;
+		__cpuid_count(7, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+		avx2 = ((xcr0 & 0x6) == 0x6) && testBit(regs[1], 5);
+	}
+	if (avx2) return SimdLevel::AVX2;
+	if (sse2) return SimdLevel::SSE2;
+#endif
+	return SimdLevel::Scalar;
+}
+
+const ScanlineKernels& getScanlineKernels(SimdLevel level)
+{
+#if SIMD_X86
+	switch (level) {
+		case SimdLevel::AVX2: return avx2Kernels;
+		case SimdLevel::SSE2: return sse2Kernels;
+		default: break;
+	}
+#endif
+	return scalarKernels;
+}
+
+const ScanlineKernels& getScanlineKernels()
+{
+	static const ScanlineKernels& best = getScanlineKernels(detectSimdLevel());
+	return best;
+}
+
+const char* simdLevelName(SimdLevel level)
+{
+	switch (level) {
+		case SimdLevel::AVX2: return "AVX2";
+		case SimdLevel::SSE2: return "SSE2";
+		default: break;
+	}
+	return "Scalar";
+}
+
+/*
+	Benchmark
+*/
+#define BENCH_WIDTH 240
+#define BENCH_ITERATIONS 100000
+
+static u32 benchSeed = 0x12345678;
+static u32 benchRandom()
+{
+	benchSeed = benchSeed * 1664525 + 1013904223;
+	return benchSeed;
+}
+
+template<typename Fn>
+static double timeKernel(Fn fn)
+{
+	auto start = std::chrono::high_resolution_clock::now();
+	for (u32 i = 0; i < BENCH_ITERATIONS; i++)
+		fn();
+	auto end = std::chrono::high_resolution_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count() / BENCH_ITERATIONS;
+}
+
+void runScanlineKernelBenchmark()
+{
+	u16 colors[BENCH_WIDTH];
+	u8 packed[BENCH_WIDTH / 2];
+	u32 top[BENCH_WIDTH], bottom[BENCH_WIDTH];
+	for (u32 i = 0; i < BENCH_WIDTH; i++) {
+		colors[i] = benchRandom() & 0xFFFF;
+		//roughly a quarter of the layer pixels are transparent
+		top[i] = (benchRandom() & 0x3) ? (benchRandom() | OPAQUE_ALPHA) : 0;
+		bottom[i] = (benchRandom() & 0x3) ? (benchRandom() | OPAQUE_ALPHA) : 0;
+	}
+	for (u32 i = 0; i < BENCH_WIDTH / 2; i++)
+		packed[i] = benchRandom() & 0xFF;
+
+	u32 expected[7][BENCH_WIDTH];
+	u32 result[BENCH_WIDTH];
+	u8 indices[BENCH_WIDTH];
+	SimdLevel best = detectSimdLevel();
+
+	printf("Scanline kernels, %d pixels per line, host supports %s\n", BENCH_WIDTH, simdLevelName(best));
+	printf("%-8s %10s %10s %10s %10s %10s %10s %10s\n", "level", "convert", "unpack4",
+		"merge", "backdrop", "blend", "brighten", "darken");
+
+	for (u8 l = 0; l <= (u8)best; l++) {
+		const ScanlineKernels& k = getScanlineKernels((SimdLevel)l);
+		double ns[7];
+		bool match = true;
+		auto check = [&](u32 slot, const void* data, u32 size) {
+			if (l == 0) memcpy(expected[slot], data, size);
+			else if (memcmp(expected[slot], data, size) != 0) match = false;
+		};
+
+		ns[0] = timeKernel([&]() { k.convertBgr555(colors, result, BENCH_WIDTH); });
+		check(0, result, sizeof(result));
+		ns[1] = timeKernel([&]() { k.unpack4bpp(packed, indices, BENCH_WIDTH / 2); });
+		check(1, indices, sizeof(indices));
+		ns[2] = timeKernel([&]() { memcpy(result, top, sizeof(result)); k.mergeLayer(result, bottom, BENCH_WIDTH); });
+		check(2, result, sizeof(result));
+		ns[3] = timeKernel([&]() { memcpy(result, top, sizeof(result)); k.fillTransparent(result, 0xFF7F7F7F, BENCH_WIDTH); });
+		check(3, result, sizeof(result));
+		ns[4] = timeKernel([&]() { k.alphaBlend(result, top, bottom, 12, 6, BENCH_WIDTH); });
+		check(4, result, sizeof(result));
+		ns[5] = timeKernel([&]() { k.brighten(result, top, 9, BENCH_WIDTH); });
+		check(5, result, sizeof(result));
+		ns[6] = timeKernel([&]() { k.darken(result, top, 9, BENCH_WIDTH); });
+		check(6, result, sizeof(result));
+
+		printf("%-8s", simdLevelName(k.level));
+		for (u32 i = 0; i < 7; i++)
+			printf(" %8.1fns", ns[i]);
+		printf("%s\n", match ? "" : "  MISMATCH vs scalar");
+	}
+}
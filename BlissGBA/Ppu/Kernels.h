@@ -0,0 +1,46 @@
+#pragma once
+#include "../Utils/Utils.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86 1
+#else
+#define SIMD_X86 0
+#endif
+
+enum class SimdLevel : u8 {
+	Scalar = 0,
+	SSE2,
+	AVX2
+};
+
+/*
+	Scanline pixel kernels. All colors are RGBA8888 (r in the lowest byte),
+	layer pixels with a value of 0 are transparent.
+	Blend coefficients are in 1/16ths and must already be clamped to 16.
+*/
+struct ScanlineKernels {
+	SimdLevel level;
+	//Bit exact with the ColorLut when color correction is off
+	void (*convertBgr555)(const u16* src, u32* dst, u32 count);
+	//Each byte becomes 2 palette indices, lower nibble first
+	void (*unpack4bpp)(const u8* src, u8* dst, u32 bytes);
+	//Fill transparent dst pixels from layer (layers are merged front to back)
+	void (*mergeLayer)(u32* dst, const u32* layer, u32 count);
+	void (*fillTransparent)(u32* dst, u32 color, u32 count);
+	//dst = min(255, top * eva + bottom * evb)
+	void (*alphaBlend)(u32* dst, const u32* top, const u32* bottom, u8 eva, u8 evb, u32 count);
+	//dst = src + (white - src) * evy
+	void (*brighten)(u32* dst, const u32* src, u8 evy, u32 count);
+	//dst = src - src * evy
+	void (*darken)(u32* dst, const u32* src, u8 evy, u32 count);
+};
+
+SimdLevel detectSimdLevel();
+const ScanlineKernels& getScanlineKernels(SimdLevel level);
+//Kernels for the best level the host cpu supports
+const ScanlineKernels& getScanlineKernels();
+const char* simdLevelName(SimdLevel level);
+
+//Times every kernel at each supported level against the scalar path
+//and checks the results match, prints to stdout
+void runScanlineKernelBenchmark();
@@ -19,3 +19,35 @@
 #define BG2VOFS 0x400001A
 #define BG3HOFS 0x400001C
 #define BG3VOFS 0x400001E
+
+//LCD BG Rotation/Scaling
+#define BG2PA 0x4000020
+#define BG2PB 0x4000022
+#define BG2PC 0x4000024
+#define BG2PD 0x4000026
+#define BG2X_L 0x4000028
+#define BG2X_H 0x400002A
+#define BG2Y_L 0x400002C
+#define BG2Y_H 0x400002E
+#define BG3PA 0x4000030
+#define BG3PB 0x4000032
+#define BG3PC 0x4000034
+#define BG3PD 0x4000036
+#define BG3X_L 0x4000038
+#define BG3X_H 0x400003A
+#define BG3Y_L 0x400003C
+#define BG3Y_H 0x400003E
+
+//LCD Window
+#define WIN0H 0x4000040
+#define WIN1H 0x4000042
+#define WIN0V 0x4000044
+#define WIN1V 0x4000046
+#define WININ 0x4000048
+#define WINOUT 0x400004A
+
+//LCD Mosaic/Color Special Effects
+#define MOSAIC 0x400004C
+#define BLDCNT 0x4000050
+#define BLDALPHA 0x4000052
+#define BLDY 0x4000054
@@ -0,0 +1,28 @@
+#pragma once
+#include "../Utils/Utils.h"
+#include "Lcd.h"
+
+#define LCD_REGS_SIZE 0x56 //DISPCNT - BLDY
+#define NUM_AFFINE_BACKGROUNDS 2
+
+/*
+	Everything a scanline is drawn from apart from vram/pram/oam, captured on the
+	emulation thread when the line is reached. Display memory isn't copied, the
+	line instead records how many writes to it had been made. Those are replayed
+	into the ppu's copy before the line is drawn
+*/
+struct LineSnapshot {
+	inline u16 read(u32 address) const
+	{
+		u32 index = address - DISPCNT;
+		return io[index] | (io[index + 1] << 8);
+	}
+
+	u16 line;
+	//Internal affine reference points (20.8) for bg 2 and 3 on this line
+	s32 refX[NUM_AFFINE_BACKGROUNDS];
+	s32 refY[NUM_AFFINE_BACKGROUNDS];
+	u8 io[LCD_REGS_SIZE];
+	//Display memory writes made before the line was reached
+	u32 displayWriteMark;
+};
@@ -0,0 +1,74 @@
+#include "Palette.h"
+#include <cmath>
+
+u32 ColorLut::table[COLOR_LUT_SIZE];
+bool ColorLut::built = false;
+bool ColorLut::colorCorrection = false;
+
+void ColorLut::build(bool colorCorrection)
+{
+	ColorLut::colorCorrection = colorCorrection;
+
+	for (u32 color = 0; color < COLOR_LUT_SIZE; color++) {
+		u8 r5 = color & 0x1F;
+		u8 g5 = (color >> 5) & 0x1F;
+		u8 b5 = (color >> 10) & 0x1F;
+
+		u8 red, green, blue;
+		if (!colorCorrection) {
+			//Extend 5 bit color val into 8 bits
+			red = (r5 << 3) | (r5 >> 2);
+			green = (g5 << 3) | (g5 >> 2);
+			blue = (b5 << 3) | (b5 >> 2);
+		}
+		else {
+			//The lcd is darker than a pc monitor and its channels bleed
+			//into each other, approximate it (lcd gamma 4.0, output gamma 2.2)
+			const double lcd_gamma = 4.0;
+			const double out_gamma = 2.2;
+			double lr = std::pow(r5 / 31.0, lcd_gamma);
+			double lg = std::pow(g5 / 31.0, lcd_gamma);
+			double lb = std::pow(b5 / 31.0, lcd_gamma);
+
+			double r = std::pow((0 * lb + 50 * lg + 255 * lr) / 255.0, 1.0 / out_gamma) * (255.0 * 255.0 / 280.0);
+			double g = std::pow((30 * lb + 230 * lg + 10 * lr) / 255.0, 1.0 / out_gamma) * (255.0 * 255.0 / 280.0);
+			double b = std::pow((220 * lb + 10 * lg + 50 * lr) / 255.0, 1.0 / out_gamma) * (255.0 * 255.0 / 280.0);
+
+			red = (u8)std::min(r, 255.0);
+			green = (u8)std::min(g, 255.0);
+			blue = (u8)std::min(b, 255.0);
+		}
+		table[color] = (0xFF << 24) | (blue << 16) | (green << 8) | red;
+	}
+	built = true;
+}
+
+PaletteCache::PaletteCache(DisplayMemory* displayMem)
+	:displayMem(displayMem)
+{
+	if (!ColorLut::built)
+		ColorLut::build(false);
+	invalidateAll();
+}
+
+void PaletteCache::sync()
+{
+	for (u32 bank = 0; bank < PALETTE_BANKS; bank++) {
+		u32 version = displayMem->pramDirty.getVersion(bank);
+		if (valid && bankVersion[bank] == version)
+			continue;
+
+		//2 bytes per palette entry, 16 entries per bank
+		u32 first = bank * (PRAM_PAGE_SIZE / 2);
+		for (u32 i = first; i < first + (PRAM_PAGE_SIZE / 2); i++) {
+			colors[i] = ColorLut::convert(displayMem->readPramU16(i * 2));
+		}
+		bankVersion[bank] = version;
+	}
+	valid = true;
+}
+
+void PaletteCache::invalidateAll()
+{
+	valid = false;
+}
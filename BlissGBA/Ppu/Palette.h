@@ -0,0 +1,37 @@
+#pragma once
+#include "../Utils/Utils.h"
+#include "../Memory/DisplayMemory.h"
+
+#define COLOR_LUT_SIZE 0x8000 //every BGR555 color
+#define PALETTE_ENTRIES 0x200 //256 bg + 256 obj colors
+#define PALETTE_BANKS (BG_OBJ_PALETTE_SIZE / PRAM_PAGE_SIZE)
+
+/*
+	BGR555 -> RGBA8888 (r in the lowest byte) conversion table shared by
+	every ppu instance, optionally with the gba lcd's color response baked in
+*/
+struct ColorLut {
+	static void build(bool colorCorrection);
+	static inline u32 convert(u16 color) { return table[color & 0x7FFF]; }
+
+	static u32 table[COLOR_LUT_SIZE];
+	static bool built;
+	static bool colorCorrection;
+};
+
+/*
+	Palette ram converted to RGBA8888. Banks are refreshed from pram
+	when their dirty version changes, so render loops never touch the bus
+*/
+struct PaletteCache {
+	PaletteCache(DisplayMemory* displayMem);
+	void sync();
+	void invalidateAll();
+	inline u32 get(u16 index) const { return colors[index]; }
+
+	u32 colors[PALETTE_ENTRIES];
+	u32 bankVersion[PALETTE_BANKS];
+	bool valid;
+
+	DisplayMemory* displayMem;
+};
@@ -2,12 +2,24 @@
 #include "../Memory/MemoryBus.h"
 
 Ppu::Ppu(MemoryBus *mbus, float displayScaleFactor)
-	:mbus(mbus)
+	:kernels(&getScanlineKernels()), renderMem(), tileCache(&renderMem), palette(&renderMem),
+	objs(&renderMem, &tileCache, &palette), compositor(kernels), mbus(mbus)
 {
+	displayWritesLogged = 0;
+	displayWritesApplied = 0;
 	this->displayScaleFactor = displayScaleFactor;
+	renderMode = PpuRenderMode::CatchUp;
+	workerRunning = false;
+	lineRegs = nullptr;
+	renderEpoch = 0;
 	reset();
 }
 
+Ppu::~Ppu()
+{
+	stopWorker();
+}
+
 void Ppu::update(s32 cycles)
 {
 	cycleCounter += cycles;
@@ -17,7 +29,7 @@ void Ppu::update(s32 cycles)
 			//counter >= 1006 (hblank is off until this point)
 			if (cycleCounter >= (HBLANK_START + 46)) {
 				if (currentScanline < SCREEN_HEIGHT)
-					render();
+					scheduleLine();
 
 				displayMode = DisplayMode::HBlank;
 				setHBlankFlag(1);
@@ -33,6 +45,11 @@ void Ppu::update(s32 cycles)
 
 				//Enable VBlank
 				if (currentScanline == SCREEN_HEIGHT) {
+					sync();
+					frame.swap(frameChanged);
+					frameChanged = false;
+					latchReferencePoint(2);
+					latchReferencePoint(3);
 					displayMode = DisplayMode::VBlank;
 					setVBlankFlag(1);
 					requestInterrupt(VBLANK_INT);
@@ -60,167 +77,585 @@ void Ppu::update(s32 cycles)
 
 void Ppu::render(sf::RenderTarget& target)
 {
-	if (mode == BGMode::ZERO)
-		target.draw(mode0.frame);
-	else if (mode == BGMode::THREE)
-		target.draw(mode3.frame);
-	else if (mode == BGMode::FOUR)
-		target.draw(mode4.frame);
+	target.draw(screen.sprite);
 }
 
 void Ppu::reset()
 {
-	mode0.pixels.create(SCREEN_WIDTH, SCREEN_HEIGHT, sf::Color::Black);
-	mode0.framebuffer.loadFromImage(mode0.pixels);
-	mode0.frame = sf::Sprite(mode0.framebuffer);
+	sync();
+	frame.clear();
+	screen.texture.create(SCREEN_WIDTH, SCREEN_HEIGHT);
+	screen.texture.update((const sf::Uint8*)frame.getFrontBuffer());
+	screen.sprite = sf::Sprite(screen.texture);
+	screen.sprite.setScale(displayScaleFactor, displayScaleFactor);
+	screen.uploadedHash = frame.frameHash;
+	screen.uploaded = true;
+
+	std::fill(bgPriority, bgPriority + NUM_BACKGROUNDS, 0);
+	for (u8 i = 0; i < NUM_AFFINE_BACKGROUNDS; i++)
+		affineRef[i] = { 0, 0, true };
+	tileCache.invalidateAll();
+	palette.invalidateAll();
+	objs.invalidate();
+	invalidateLines();
 
-	mode3.pixels.create(SCREEN_WIDTH, SCREEN_HEIGHT, sf::Color::Black);
-	mode3.framebuffer.loadFromImage(mode3.pixels);
-	mode3.frame = sf::Sprite(mode3.framebuffer);
+	displayMode = DisplayMode::Visible;
+	currentScanline = 0;
+	dispstat = 0;
+}
 
-	mode4.pixels.create(SCREEN_WIDTH, SCREEN_HEIGHT, sf::Color::Black);
-	mode4.framebuffer.loadFromImage(mode4.pixels);
-	mode4.frame = sf::Sprite(mode4.framebuffer);
+void Ppu::scheduleLine()
+{
+	LineSnapshot snapshot;
+	captureLine(snapshot);
 
-	mode0.frame.setScale(displayScaleFactor, displayScaleFactor);
-	mode3.frame.setScale(displayScaleFactor, displayScaleFactor);
-	mode4.frame.setScale(displayScaleFactor, displayScaleFactor);
+	if (renderMode == PpuRenderMode::Immediate) {
+		renderLine(snapshot);
+		return;
+	}
 
-	displayMode = DisplayMode::Visible;
-	currentScanline = 0;
+	//A frame's lines always fit (vblank syncs), but don't rely on it
+	while (!pendingLines.push(snapshot))
+		sync();
 }
 
-void Ppu::render()
+void Ppu::captureLine(LineSnapshot& snapshot)
 {
-	u16 display_ctrl = readU16(DISPCNT);
-	setBGMode(display_ctrl);
+	const u8* io = &mbus->mmio.gm->io[DISPCNT - IO_START_ADDR];
+	std::copy(io, io + LCD_REGS_SIZE, snapshot.io);
+	snapshot.line = currentScanline;
+	setBGMode(snapshot.read(DISPCNT));
+
+	//Reference points are emulation side state, reloads come from mmio writes
+	loadReferencePoints();
+	for (u8 i = 0; i < NUM_AFFINE_BACKGROUNDS; i++) {
+		snapshot.refX[i] = affineRef[i].x;
+		snapshot.refY[i] = affineRef[i].y;
+	}
+	stepReferencePoints();
+	snapshot.displayWriteMark = displayWritesLogged;
+}
 
-	if (mode == BGMode::ZERO) {
-		renderMode0();
+void Ppu::renderLine(const LineSnapshot& snapshot)
+{
+	lineRegs = &snapshot;
+	applyDisplayWrites(snapshot.displayWriteMark);
+
+	//Same inputs as the line in the previous frame, reuse its output
+	u64 signature = lineSignature(snapshot);
+	if (signature == lineSignatures[snapshot.line]) {
+		const u32* prev = frame.getFrontBuffer() + (snapshot.line * SCREEN_WIDTH);
+		std::copy(prev, prev + SCREEN_WIDTH, frame.getBackLine(snapshot.line));
+		return;
 	}
-	else if (mode == BGMode::THREE) {
-		renderBitmapMode3();
+	lineSignatures[snapshot.line] = signature;
+	frameChanged = true;
+
+	u16 dispcnt = snapshot.read(DISPCNT);
+	palette.sync();
+
+	//Each mode draws its backgrounds into bgLines and returns the ones enabled
+	u8 bg_mask = 0;
+	switch ((BGMode)(dispcnt & 0x7)) {
+		case BGMode::ZERO: bg_mask = renderMode0(dispcnt); break;
+		case BGMode::ONE: bg_mask = renderMode1(dispcnt); break;
+		case BGMode::TWO: bg_mask = renderMode2(dispcnt); break;
+		case BGMode::THREE: bg_mask = renderBitmapMode3(dispcnt); break;
+		case BGMode::FOUR: bg_mask = renderBitmapMode4(dispcnt); break;
+		case BGMode::FIVE: bg_mask = renderBitmapMode5(dispcnt); break;
+		default: break;
 	}
-	else if (mode == BGMode::FOUR) {
-		renderBitmapMode4();
+
+	//Horizontal bg mosaic, vertical mosaic is handled by the bgs picking their line
+	u16 mosaic = snapshot.read(MOSAIC);
+	for (u8 bg = 0; bg < NUM_BACKGROUNDS; bg++) {
+		if (((bg_mask >> bg) & 0x1) && ((snapshot.read(BG0CNT + (bg * 2)) >> 6) & 0x1))
+			Compositor::applyMosaic(bgLines[bg], (mosaic & 0xF) + 1);
 	}
+
+	bool obj_enabled = (dispcnt >> 12) & 0x1;
+	if (obj_enabled)
+		objs.renderScanline(snapshot.line, dispcnt, mosaic);
+
+	CompositorRegs regs;
+	captureCompositorRegs(regs);
+	compositor.compose(regs, snapshot.line, bg_mask, bgPriority, bgLines,
+		obj_enabled ? &objs : nullptr, palette.get(0), lineBuffer);
+	writeScanline();
 }
 
-void Ppu::renderMode0()
+u64 Ppu::lineSignature(const LineSnapshot& snapshot)
 {
-	u16 bg0cnt = readU16(BG0CNT);
+	//FNV-1a over the registers plus the versions of the display memory the line reads
+	u64 hash = 0xCBF29CE484222325;
+	auto mix = [&hash](u64 value) {
+		hash ^= value;
+		hash *= 0x100000001B3;
+	};
+
+	mix(renderEpoch);
+	//DISPSTAT/VCOUNT don't affect the picture
+	mix(snapshot.read(DISPCNT));
+	for (u32 i = BG0CNT - DISPCNT; i < LCD_REGS_SIZE; i += 2)
+		mix(snapshot.read(DISPCNT + i));
+	for (u8 i = 0; i < NUM_AFFINE_BACKGROUNDS; i++) {
+		mix((u32)snapshot.refX[i]);
+		mix((u32)snapshot.refY[i]);
+	}
 
-	u8 char_base_offset = (bg0cnt >> 2) & 0x3; //offset from where to read tiledata from in vram
-	u8 bpp = (bg0cnt >> 7) & 0x1; //0 = 16 (4bpp), 1 = 256 (8bpp)
-	bool is8bpp = (bpp == 0x1);
+	const DisplayMemory& dm = renderMem;
+	mix(dm.pramDirty.writes);
+
+	u16 dispcnt = snapshot.read(DISPCNT);
+	u8 bg_mode = dispcnt & 0x7;
+	u8 bg_mask = (dispcnt >> 8) & 0xF;
+	if (bg_mode <= 2) {
+		for (u8 bg = 0; bg < NUM_BACKGROUNDS; bg++) {
+			if (!((bg_mask >> bg) & 0x1))
+				continue;
+
+			u16 bgcnt = snapshot.read(BG0CNT + (bg * 2));
+			u32 char_base = ((bgcnt >> 2) & 0x3) * CHAR_BLOCK_SIZE;
+			u32 screen_base = ((bgcnt >> 8) & 0x1F) * SCREEN_BLOCK_SIZE;
+			u8 screen_size = (bgcnt >> 14) & 0x3;
+
+			//Affine maps are 16 - 128 tiles square with 1 byte entries and 256 8bpp tiles,
+			//text maps are 1 - 4 screen blocks and can reach 1024 tiles
+			bool affine = (bg_mode == 1 && bg == 2) || (bg_mode == 2 && bg >= 2);
+			u32 tiles_size, map_size;
+			if (affine) {
+				u32 map_tiles = 16 << screen_size;
+				tiles_size = 256 * 64;
+				map_size = map_tiles * map_tiles;
+			}
+			else {
+				bool is8bpp = (bgcnt >> 7) & 0x1;
+				tiles_size = 1024 * (is8bpp ? 64 : 32);
+				map_size = SCREEN_BLOCK_SIZE * ((screen_size == 3) ? 4 : ((screen_size == 0) ? 1 : 2));
+			}
+			tiles_size = std::min(tiles_size, BG_TILE_DATA_END - char_base);
+			mix(dm.vramDirty.getVersionSum(char_base, tiles_size));
+			mix(dm.vramDirty.getVersionSum(screen_base, map_size));
+		}
+	}
+	else if ((bg_mask >> 2) & 0x1) {
+		//Bitmap modes only read the one row of bg 2
+		u16 y = getMosaicLine(snapshot.read(BG2CNT));
+		u32 page = getBitmapPage(dispcnt) - dm.vram;
+		if (bg_mode == 3)
+			mix(dm.vramDirty.getVersionSum(y * SCREEN_WIDTH * BM_MODE3_BPP, SCREEN_WIDTH * BM_MODE3_BPP));
+		else if (bg_mode == 4)
+			mix(dm.vramDirty.getVersionSum(page + (y * SCREEN_WIDTH * BM_MODE4_BPP), SCREEN_WIDTH * BM_MODE4_BPP));
+		else if (bg_mode == 5 && y < BM_MODE5_HEIGHT)
+			mix(dm.vramDirty.getVersionSum(page + (y * BM_MODE5_WIDTH * BM_MODE3_BPP), BM_MODE5_WIDTH * BM_MODE3_BPP));
+	}
 
-	for (u32 x = 0; x < SCREEN_WIDTH; x++) {
-		//tile data is in units of 16k bytes
-		u32 offset = char_base_offset * 0x4000;
-		u32 tile_address = VRAM_START_ADDR + offset;
-		
-		u8 bits_pp = (is8bpp) ? 8 : 4;
-		//u32 index = calculateTileOffset(x, currentScanline, bits_pp);
-		u32 index = 0;
-		if (bits_pp == 8) {
+	if ((dispcnt >> 12) & 0x1) {
+		mix(dm.oamDirty.writes);
+		mix(dm.vramDirty.getVersionSum(OBJ_TILE_BASE, VRAM_SIZE - OBJ_TILE_BASE));
+	}
+	return hash;
+}
+
+void Ppu::invalidateLines()
+{
+	//Old signatures can't match anymore, the next frame is drawn in full
+	renderEpoch++;
+	std::fill(lineSignatures, lineSignatures + SCREEN_HEIGHT, 0);
+	frameChanged = true;
+}
+
+void Ppu::setRenderMode(PpuRenderMode mode)
+{
+	if (mode == renderMode)
+		return;
+
+	sync();
+	stopWorker();
+	renderMode = mode;
+	if (renderMode == PpuRenderMode::Threaded) {
+		workerRunning = true;
+		worker = std::thread(&Ppu::workerLoop, this);
+	}
+}
+
+void Ppu::sync()
+{
+	if (renderMode == PpuRenderMode::CatchUp) {
+		catchUp();
+		return;
+	}
+
+	//Wait until the worker has drawn every queued line
+	while (!pendingLines.empty())
+		std::this_thread::yield();
+}
 
+void Ppu::applyDisplayWrites(u32 mark)
+{
+	//Only the side drawing the lines replays, so renderMem never changes under a line
+	while (displayWritesApplied != mark) {
+		DisplayWrite* write = displayWrites.front();
+		switch (write->size) {
+			case 1: renderMem.writeU8(write->address, write->value); break;
+			case 2: renderMem.writeU16(write->address, write->value); break;
+			default: renderMem.writeU32(write->address, write->value); break;
 		}
-		else {
+		displayWrites.pop();
+		displayWritesApplied++;
+	}
+}
+
+void Ppu::resyncDisplayMemory()
+{
+	//For changes made without going through the writes, drop the log and copy everything
+	sync();
+	applyDisplayWrites(displayWritesLogged);
+	const DisplayMemory& dm = mbus->displayMem;
+	std::copy(dm.pram, dm.pram + BG_OBJ_PALETTE_SIZE, renderMem.pram);
+	std::copy(dm.vram, dm.vram + VRAM_SIZE, renderMem.vram);
+	std::copy(dm.oam, dm.oam + OAM_SIZE, renderMem.oam);
+	renderMem.vramDirty.markAll();
+	renderMem.pramDirty.markAll();
+	renderMem.oamDirty.markAll();
+}
 
+void Ppu::catchUp()
+{
+	//Draw everything pending in one go, normally the whole frame at vblank.
+	//Display memory writes don't force it, they are replayed line by line
+	while (LineSnapshot* snapshot = pendingLines.front()) {
+		renderLine(*snapshot);
+		pendingLines.pop();
+	}
+}
+
+void Ppu::workerLoop()
+{
+	u32 idle = 0;
+	while (workerRunning.load(std::memory_order_acquire)) {
+		LineSnapshot* snapshot = pendingLines.front();
+		if (!snapshot) {
+			//Nothing is produced during vblank or while paused, stop spinning
+			if (++idle < PPU_WORKER_SPIN)
+				std::this_thread::yield();
+			else
+				std::this_thread::sleep_for(std::chrono::microseconds(100));
+			continue;
 		}
-		u16 tile = readU16(tile_address + 96);
-		u8 paletteNumber = (tile >> 12) & 0xF;
 
-		//Get color of tile pixel from palette ram
-		u32 pramAddr = PRAM_START_ADDR;
-		if (is8bpp) {
-			pramAddr = PRAM_START_ADDR + (tile);
+		idle = 0;
+		renderLine(*snapshot);
+		//Release the slot only once the line is in the frame buffer
+		pendingLines.pop();
+	}
+}
+
+void Ppu::stopWorker()
+{
+	workerRunning = false;
+	if (worker.joinable())
+		worker.join();
+}
+
+u8 Ppu::renderMode0(u16 dispcnt)
+{
+	//bits 8 - 11 enable bg 0 - 3
+	u8 bg_mask = (dispcnt >> 8) & 0xF;
+
+	for (u8 bg = 0; bg < NUM_BACKGROUNDS; bg++) {
+		if ((bg_mask >> bg) & 0x1)
+			renderTextBG(bg);
+	}
+	return bg_mask;
+}
+
+u8 Ppu::renderMode1(u16 dispcnt)
+{
+	//bg 0 and 1 are text backgrounds, bg 2 is affine and bg 3 is unused
+	u8 bg_mask = (dispcnt >> 8) & 0x7;
+
+	for (u8 bg = 0; bg < 2; bg++) {
+		if ((bg_mask >> bg) & 0x1)
+			renderTextBG(bg);
+	}
+	if ((bg_mask >> 2) & 0x1)
+		renderAffineBG(2);
+	return bg_mask;
+}
+
+u8 Ppu::renderMode2(u16 dispcnt)
+{
+	//bg 2 and 3 are affine, bg 0 and 1 are unused
+	u8 bg_mask = (dispcnt >> 8) & 0xC;
+
+	for (u8 bg = 2; bg < NUM_BACKGROUNDS; bg++) {
+		if ((bg_mask >> bg) & 0x1)
+			renderAffineBG(bg);
+	}
+	return bg_mask;
+}
+
+void Ppu::renderTextBG(u8 bg)
+{
+	u16 bgcnt = lineRegs->read(BG0CNT + (bg * 2));
+	u16 hofs = lineRegs->read(BG0HOFS + (bg * 4)) & 0x1FF;
+	u16 vofs = lineRegs->read(BG0VOFS + (bg * 4)) & 0x1FF;
+
+	bgPriority[bg] = bgcnt & 0x3;
+	u32 char_base = ((bgcnt >> 2) & 0x3) * CHAR_BLOCK_SIZE; //tile data
+	bool is8bpp = ((bgcnt >> 7) & 0x1); //0 = 16 (4bpp), 1 = 256 (8bpp)
+	u32 screen_base = ((bgcnt >> 8) & 0x1F) * SCREEN_BLOCK_SIZE; //map data
+	
+	//0 = 256x256, 1 = 512x256, 2 = 256x512, 3 = 512x512
+	u8 screen_size = (bgcnt >> 14) & 0x3;
+	u32 width = (screen_size & 0x1) ? 512 : 256;
+	u32 height = (screen_size & 0x2) ? 512 : 256;
+
+	u32 y = (getMosaicLine(bgcnt) + vofs) & (height - 1);
+	u32 tile_y = y / 8;
+	u8 row = y % 8;
+
+	u32* line = bgLines[bg];
+	u32 x = 0;
+	//Walk the line one tile (or partial tile at the edges) at a time
+	while (x < SCREEN_WIDTH) {
+		u32 map_x = (x + hofs) & (width - 1);
+		u32 tile_x = map_x / 8;
+
+		//Each screen block holds 32x32 tiles, wide maps place the right half in the
+		//next block and tall maps place the bottom half after the top blocks
+		u32 block = (tile_x / TEXT_BG_MAP_SIZE) + ((tile_y / TEXT_BG_MAP_SIZE) * (width / 256));
+		u32 entry_addr = screen_base + (block * SCREEN_BLOCK_SIZE)
+			+ ((((tile_y % TEXT_BG_MAP_SIZE) * TEXT_BG_MAP_SIZE) + (tile_x % TEXT_BG_MAP_SIZE)) * 2);
+		u16 entry = renderMem.readVramU16(entry_addr);
+
+		u16 tile_number = entry & 0x3FF;
+		bool hflip = ((entry >> 10) & 0x1);
+		bool vflip = ((entry >> 11) & 0x1);
+		u8 palette_bank = (entry >> 12) & 0xF;
+
+		u8 start_px = map_x % 8;
+		u32 count = std::min<u32>(8 - start_px, SCREEN_WIDTH - x);
+		u32 tile_addr = char_base + (tile_number * (is8bpp ? 64 : 32));
+
+		if (tile_addr >= BG_TILE_DATA_END) {
+			std::fill(line + x, line + x + count, TRANSPARENT_PIXEL);
 		}
 		else {
-			u8 lower_pixel = tile & 0xF;
-			u8 offset = lower_pixel;
-			offset &= 0xF;
-			offset |= (tile << 4);
-			pramAddr = PRAM_START_ADDR + ((offset * 2) + (16 * paletteNumber));
+			const u8* tile = (is8bpp) ? tileCache.getTile8bpp(tile_addr) : tileCache.getTile4bpp(tile_addr);
+			const u8* pixels = &tile[(vflip ? (7 - row) : row) * 8];
+			u16 palette_base = (is8bpp) ? 0 : (palette_bank * 16);
+
+			for (u32 i = 0; i < count; i++) {
+				u8 px = start_px + i;
+				u8 index = pixels[hflip ? (7 - px) : px];
+				line[x + i] = (index == 0) ? TRANSPARENT_PIXEL : palette.get(palette_base + index);
+			}
 		}
-		u16 palette = readU16(pramAddr);
+		x += count;
+	}
+}
 
-		u8 red = getU8Color((palette & 0x1F));
-		u8 green = getU8Color((palette >> 5) & 0x1F);
-		u8 blue = getU8Color((palette >> 10) & 0x1F);
+void Ppu::renderAffineBG(u8 bg)
+{
+	u16 bgcnt = lineRegs->read(BG0CNT + (bg * 2));
+	u32 regs = (bg == 2) ? BG2PA : BG3PA;
+	s16 pa = (s16)lineRegs->read(regs);
+	s16 pc = (s16)lineRegs->read(regs + 4);
+
+	bgPriority[bg] = bgcnt & 0x3;
+	u32 char_base = ((bgcnt >> 2) & 0x3) * CHAR_BLOCK_SIZE;
+	u32 screen_base = ((bgcnt >> 8) & 0x1F) * SCREEN_BLOCK_SIZE;
+	bool wrap = (bgcnt >> 13) & 0x1;
+
+	//0 = 128x128, 1 = 256x256, 2 = 512x512, 3 = 1024x1024, always 8bpp
+	//with one byte map entries
+	s32 size = 128 << ((bgcnt >> 14) & 0x3);
+	u32 tiles_per_row = size / 8;
+
+	const u8* vram = renderMem.vram;
+	u32* line = bgLines[bg];
+
+	//Walk the texture by adding PA/PC for every pixel instead of transforming each one
+	s32 x = lineRegs->refX[bg - 2];
+	s32 y = lineRegs->refY[bg - 2];
+	for (u32 i = 0; i < SCREEN_WIDTH; i++, x += pa, y += pc) {
+		s32 tx = x >> 8;
+		s32 ty = y >> 8;
+		if (wrap) {
+			tx &= (size - 1);
+			ty &= (size - 1);
+		}
+		else if (tx < 0 || ty < 0 || tx >= size || ty >= size) {
+			line[i] = TRANSPARENT_PIXEL;
+			continue;
+		}
+
+		u8 tile_number = vram[screen_base + ((ty / 8) * tiles_per_row) + (tx / 8)];
+		u32 tile_addr = char_base + (tile_number * 64);
+		if (tile_addr >= BG_TILE_DATA_END) {
+			line[i] = TRANSPARENT_PIXEL;
+			continue;
+		}
 
-		const sf::Color color = sf::Color(red, green, blue, 255);
-		mode0.pixels.setPixel(x, currentScanline, color);
+		u8 index = tileCache.getTile8bpp(tile_addr)[((ty % 8) * 8) + (tx % 8)];
+		line[i] = (index == 0) ? TRANSPARENT_PIXEL : palette.get(index);
 	}
 }
 
-void Ppu::renderBitmapMode3()
+void Ppu::latchReferencePoint(u8 bg)
 {
-	for (u32 x = 0; x < SCREEN_WIDTH; x++) {
-		//2 bytes associated to each pixel(defining one of the 32768 colors)
-		u32 index = ((currentScanline * SCREEN_WIDTH + x) * mode3.bpp);
-		u16 pixel = readU16(VRAM_START_ADDR + index);
+	affineRef[bg - 2].reload = true;
+}
 
-		u8 red = getU8Color((pixel & 0x1F));
-		u8 green = getU8Color((pixel >> 5) & 0x1F);
-		u8 blue = getU8Color((pixel >> 10) & 0x1F);
+void Ppu::loadReferencePoints()
+{
+	for (u8 i = 0; i < NUM_AFFINE_BACKGROUNDS; i++) {
+		if (!affineRef[i].reload)
+			continue;
+
+		//28 bit signed, sign extend from bit 27
+		u32 regs = BG2PA + (i * AFFINE_BG_REGS_SIZE);
+		u32 x = readIo(regs + 8) | (readIo(regs + 10) << 16);
+		u32 y = readIo(regs + 12) | (readIo(regs + 14) << 16);
+		affineRef[i].x = (s32)(x << 4) >> 4;
+		affineRef[i].y = (s32)(y << 4) >> 4;
+		affineRef[i].reload = false;
+	}
+}
 
-		const sf::Color color = sf::Color(red, green, blue, 255);
-		mode3.pixels.setPixel(x, currentScanline, color);
+void Ppu::stepReferencePoints()
+{
+	//Moves the start of the next line by PB/PD
+	for (u8 i = 0; i < NUM_AFFINE_BACKGROUNDS; i++) {
+		u32 regs = BG2PA + (i * AFFINE_BG_REGS_SIZE);
+		affineRef[i].x += (s16)readIo(regs + 2);
+		affineRef[i].y += (s16)readIo(regs + 6);
 	}
 }
 
-void Ppu::renderBitmapMode4()
+void Ppu::captureCompositorRegs(CompositorRegs& regs)
 {
-	u16 dispcnt = mbus->mmio.readDISPCNT();
-	u8 frame = (dispcnt >> 4) & 0x1;
-	
-	//Use frame 0 or 1
-	u32 page = VRAM_START_ADDR + (0xA000 * frame);
+	regs.dispcnt = lineRegs->read(DISPCNT);
+	regs.winH[0] = lineRegs->read(WIN0H);
+	regs.winH[1] = lineRegs->read(WIN1H);
+	regs.winV[0] = lineRegs->read(WIN0V);
+	regs.winV[1] = lineRegs->read(WIN1V);
+	regs.winIn = lineRegs->read(WININ);
+	regs.winOut = lineRegs->read(WINOUT);
+	regs.bldcnt = lineRegs->read(BLDCNT);
+	regs.bldalpha = lineRegs->read(BLDALPHA);
+	regs.bldy = lineRegs->read(BLDY);
+}
 
-	for (u32 x = 0; x < SCREEN_WIDTH; x++) {
-		u32 index = ((currentScanline * SCREEN_WIDTH + x) * mode4.bpp);
-		u8 paletteIndex = readU8(page + index);
+u16 Ppu::getMosaicLine(u16 bgcnt)
+{
+	//Mosaic bgs repeat the first line of every block
+	if (!((bgcnt >> 6) & 0x1))
+		return lineRegs->line;
 
-		u32 pramAddr = PRAM_START_ADDR + (paletteIndex * 2);
-		u16 palette = readU16(pramAddr);
+	u8 size = ((lineRegs->read(MOSAIC) >> 4) & 0xF) + 1;
+	return lineRegs->line - (lineRegs->line % size);
+}
 
-		u8 red = getU8Color((palette & 0x1F));
-		u8 green = getU8Color((palette >> 5) & 0x1F);
-		u8 blue = getU8Color((palette >> 10) & 0x1F);
+void Ppu::writeScanline()
+{
+	u32* line = frame.getBackLine(lineRegs->line);
+	std::copy(lineBuffer, lineBuffer + SCREEN_WIDTH, line);
+}
 
-		const sf::Color color = sf::Color(red, green, blue, 255);
-		mode4.pixels.setPixel(x, currentScanline, color);
+void Ppu::convertLine(const u16* src, u32* dst, u32 count)
+{
+	//Color correction isn't a closed form, it has to go through the lut
+	if (ColorLut::colorCorrection) {
+		for (u32 i = 0; i < count; i++)
+			dst[i] = ColorLut::convert(src[i]);
 	}
+	else
+		kernels->convertBgr555(src, dst, count);
 }
 
-void Ppu::bufferPixels()
+const u8* Ppu::getBitmapPage(u16 dispcnt)
+{
+	//Frame select only moves the pointer, nothing is copied
+	u8 page_select = (dispcnt >> 4) & 0x1;
+	return &renderMem.vram[BM_PAGE_SIZE * page_select];
+}
+
+//The bitmap modes read whole lines straight out of vram (it is little endian
+//like the host), drawn as bg 2
+u8 Ppu::renderBitmapMode3(u16 dispcnt)
+{
+	if (!((dispcnt >> 10) & 0x1))
+		return 0;
+	u16 bgcnt = lineRegs->read(BG2CNT);
+	bgPriority[2] = bgcnt & 0x3;
+
+	//2 bytes associated to each pixel(defining one of the 32768 colors),
+	//single page covering the whole screen
+	u32 index = getMosaicLine(bgcnt) * SCREEN_WIDTH * BM_MODE3_BPP;
+	const u16* src = (const u16*)&renderMem.vram[index];
+
+	convertLine(src, bgLines[2], SCREEN_WIDTH);
+	return 0x4;
+}
+
+u8 Ppu::renderBitmapMode4(u16 dispcnt)
+{
+	if (!((dispcnt >> 10) & 0x1))
+		return 0;
+	u16 bgcnt = lineRegs->read(BG2CNT);
+	bgPriority[2] = bgcnt & 0x3;
+
+	const u8* src = getBitmapPage(dispcnt) + (getMosaicLine(bgcnt) * SCREEN_WIDTH * BM_MODE4_BPP);
+	u32* line = bgLines[2];
+	for (u32 x = 0; x < SCREEN_WIDTH; x++) {
+		//Index 0 is transparent like in the tiled modes
+		u8 index = src[x];
+		line[x] = (index == 0) ? TRANSPARENT_PIXEL : palette.get(index);
+	}
+	return 0x4;
+}
+
+u8 Ppu::renderBitmapMode5(u16 dispcnt)
 {
-	if (mode == BGMode::ZERO)
-		mode0.framebuffer.update(mode0.pixels);
-	else if (mode == BGMode::THREE)
-		mode3.framebuffer.update(mode3.pixels);
-	else if (mode == BGMode::FOUR)
-		mode4.framebuffer.update(mode4.pixels);
+	if (!((dispcnt >> 10) & 0x1))
+		return 0;
+	u16 bgcnt = lineRegs->read(BG2CNT);
+	bgPriority[2] = bgcnt & 0x3;
+
+	//160x128 16 bit bitmap, the rest of the screen shows what is behind bg 2
+	u32* line = bgLines[2];
+	u16 y = getMosaicLine(bgcnt);
+	if (y >= BM_MODE5_HEIGHT) {
+		std::fill(line, line + SCREEN_WIDTH, TRANSPARENT_PIXEL);
+		return 0x4;
+	}
+
+	const u16* src = (const u16*)(getBitmapPage(dispcnt) + (y * BM_MODE5_WIDTH * BM_MODE3_BPP));
+	convertLine(src, line, BM_MODE5_WIDTH);
+	std::fill(line + BM_MODE5_WIDTH, line + SCREEN_WIDTH, TRANSPARENT_PIXEL);
+	return 0x4;
 }
 
-u32 Ppu::calculateTileOffset(u32 x, u32 y, u8 bpp)
+void Ppu::bufferPixels()
 {
-	u32 tilex = x % 8;
-	u32 tiley = y % 8;
-	u32 index = (tiley * bpp) * tilex;
+	//Nothing new to show, skip the upload (unchanged frames keep the previous hash)
+	if (screen.uploaded && screen.uploadedHash == frame.frameHash)
+		return;
 
-	return index;
+	screen.texture.update((const sf::Uint8*)frame.getFrontBuffer());
+	screen.uploadedHash = frame.frameHash;
+	screen.uploaded = true;
 }
 
 void Ppu::updateScanline()
 {
 	currentScanline++;
-	mbus->mmio.writeVCOUNT(currentScanline);
 
-	u16 lcd_stat = readU16(DISPSTAT);
-	u8 lyc = (lcd_stat >> 8) & 0xFF; //VCount setting
-	u8 vcount_irq = (lcd_stat >> 5) & 0x1;
+	u8 lyc = (dispstat >> 8) & 0xFF; //VCount setting
+	u8 vcount_irq = (dispstat >> 5) & 0x1;
 
 	if (currentScanline == lyc) {
 		setVCountFlag(1); //ly matches lyc
@@ -251,36 +686,28 @@ void Ppu::setBGMode(u16 lcdstatus)
 
 void Ppu::setHBlankFlag(bool value)
 {
-	u16 lcd_stat = readU16(DISPSTAT);
-	(value == true) ? lcd_stat = setBit(lcd_stat, 1) : lcd_stat = resetBit(lcd_stat, 1);
-
-	mbus->mmio.writeDISPSTAT(lcd_stat);
+	dispstat = (value == true) ? setBit(dispstat, 1) : resetBit(dispstat, 1);
 }
 
 void Ppu::setVBlankFlag(bool value)
 {
-	u16 lcd_stat = readU16(DISPSTAT);
-	(value == true) ? lcd_stat = setBit(lcd_stat, 0) : lcd_stat = resetBit(lcd_stat, 0);
-
-	mbus->mmio.writeDISPSTAT(lcd_stat);
+	dispstat = (value == true) ? setBit(dispstat, 0) : resetBit(dispstat, 0);
 }
 
 void Ppu::setVCountFlag(bool value)
 {
-	u16 lcd_stat = readU16(DISPSTAT);
-	(value == true) ? lcd_stat = setBit(lcd_stat, 2) : lcd_stat = resetBit(lcd_stat, 2);
+	dispstat = (value == true) ? setBit(dispstat, 2) : resetBit(dispstat, 2);
+}
 
-	mbus->mmio.writeDISPSTAT(lcd_stat);
+void Ppu::writeDISPSTAT(u16 value)
+{
+	//Bits 0 - 2 are the read only status flags
+	dispstat = (dispstat & 0x7) | (value & 0xFFF8);
 }
 
 void Ppu::setScaleFactor(float scaleFactor)
 {
-	if (mode == BGMode::ZERO)
-		mode0.frame.setScale(scaleFactor, scaleFactor);
-	else if (mode == BGMode::THREE)
-		mode3.frame.setScale(scaleFactor, scaleFactor);
-	else if (mode == BGMode::FOUR)
-		mode4.frame.setScale(scaleFactor, scaleFactor);
+	screen.sprite.setScale(scaleFactor, scaleFactor);
 }
 
 void Ppu::writeU8(u32 address, u8 value)
@@ -295,17 +722,7 @@ void Ppu::writeU16(u32 address, u16 value)
 
 void Ppu::requestInterrupt(u16 interrupt)
 {
-	u16 irq_flag = mbus->mmio.readIF();
-	irq_flag = setBit(irq_flag, interrupt);
-	mbus->mmio.writeIF(irq_flag);
-}
-
-u8 Ppu::getU8Color(u8 color)
-{
-	u8 new_color = color << 3;
-	new_color |= (color >> 2);
-
-	return new_color;
+	mbus->mmio.interrupts.request(interrupt);
 }
 
 u8 Ppu::readU8(u32 address)
@@ -317,3 +734,9 @@ u16 Ppu::readU16(u32 address)
 {
 	return mbus->readU16(address);
 }
+
+u16 Ppu::readIo(u32 address)
+{
+	//The ppu's own register reads, they skip the bus so cpu watchpoints don't see them
+	return mbus->mmio.loadIo(address - IO_START_ADDR, 2);
+}
@@ -1,15 +1,29 @@
 #pragma once
 #include <SFML\Graphics.hpp>
+#include <thread>
+#include <atomic>
+#include <chrono>
 #include "../Utils/Utils.h"
+#include "../Utils/SpscRing.h"
 #include "../Core/Interrupts.h"
 #include "Lcd.h"
+#include "TileCache.h"
+#include "Palette.h"
+#include "Kernels.h"
+#include "FrameBuffer.h"
+#include "Sprites.h"
+#include "Compositor.h"
+#include "LineSnapshot.h"
+#include "../Memory/DisplayMemory.h"
 
 class MemoryBus;
 
-#define SCREEN_WIDTH 240
-#define SCREEN_HEIGHT 160
-
 #define BM_MODE3_SIZE 0x12BFF
+#define BM_MODE3_BPP 2 //2 bytes per pixel
+#define BM_MODE4_BPP 1
+#define BM_MODE5_WIDTH 160
+#define BM_MODE5_HEIGHT 128
+#define BM_PAGE_SIZE 0xA000 //modes 4 and 5 flip between 2 pages
 
 #define HBLANK_START 960
 #define HBLANK_CYCLES 272
@@ -28,72 +42,170 @@ enum class BGMode {
 	FIVE
 };
 
-enum class DisplayMode {
-	Visible,
-	HBlank,
-	VBlank
+//Text backgrounds (regular tiled, not affine)
+#define NUM_BACKGROUNDS 4
+#define TEXT_BG_MAP_SIZE 32 //tiles per screen block side
+#define SCREEN_BLOCK_SIZE 0x800
+#define CHAR_BLOCK_SIZE 0x4000
+#define BG_TILE_DATA_END 0x10000 //bg tiles can't be fetched from obj vram
+
+//Affine backgrounds (bg 2 and 3)
+#define AFFINE_BG_REGS_SIZE 0x10 //BG2PA - BG2Y_H
+
+/*
+	Internal reference point of an affine bg, 20.8 fixed point.
+	Loaded from BGxX/BGxY at vblank and whenever those are written (picked up on the
+	next line), otherwise advanced by PB/PD after every line
+*/
+struct AffineReference {
+	s32 x;
+	s32 y;
+	bool reload;
+};
+
+//Lines captured but not drawn yet
+#define PENDING_LINES 256
+//Display memory writes not yet replayed into the render copy
+#define PENDING_DISPLAY_WRITES 0x10000
+#define PPU_WORKER_SPIN 1024 //empty polls before the worker starts sleeping
+
+enum class PpuRenderMode : u8 {
+	Immediate = 0, //draw each line on the emulation thread when it is reached
+	CatchUp, //queue line snapshots, draw them in one batch when something forces it
+	Threaded //queue line snapshots for a worker thread
 };
 
-struct Mode0 {
-	sf::Image pixels;
-	sf::Texture framebuffer;
-	sf::Sprite frame;
+/*
+	A vram/pram/oam write as the cpu or dma made it, replayed into the
+	ppu's own copy of display memory
+*/
+struct DisplayWrite {
+	u32 address;
+	u32 value;
+	u8 size;
 };
 
-struct BitmapMode3 {
-	static constexpr u8 bpp = 2; //2 bytes per pixel
-	sf::Image pixels;
-	sf::Texture framebuffer;
-	sf::Sprite frame;
+enum class DisplayMode {
+	Visible,
+	HBlank,
+	VBlank
 };
 
-struct BitmapMode4 {
-	static constexpr u8 bpp = 1;
-	sf::Image pixels;
-	sf::Texture framebuffer;
-	sf::Sprite frame;
+/*
+	Presents the frame buffer, one texture for every bg mode.
+	The texture is only uploaded again when the finished frame changed
+*/
+struct Screen {
+	sf::Texture texture;
+	sf::Sprite sprite;
+	u64 uploadedHash;
+	bool uploaded;
 };
 
 class Ppu {
 public:
 	Ppu(MemoryBus *mbus, float displayScaleFactor);
+	~Ppu();
 	void update(s32 cycles);
 	void render(sf::RenderTarget& target);
 	void reset();
-	void render();
-	void renderMode0();
-	void renderBitmapMode3();
-	void renderBitmapMode4();
+	void scheduleLine();
+	void captureLine(LineSnapshot& snapshot);
+	void renderLine(const LineSnapshot& snapshot);
+	u64 lineSignature(const LineSnapshot& snapshot);
+	void invalidateLines();
+	void setRenderMode(PpuRenderMode mode);
+	void sync();
+	void catchUp();
+	//Called on every vram/pram/oam write. Queued lines must still see the
+	//old contents, so the write only reaches renderMem once they are drawn
+	inline void logDisplayWrite(u32 address, u32 value, u8 size)
+	{
+		if (!displayWrites.push({ address, value, size })) {
+			//Lots of writes with no line drawn in between, catch up first
+			sync();
+			applyDisplayWrites(displayWritesLogged);
+			displayWrites.push({ address, value, size });
+		}
+		displayWritesLogged++;
+	}
+	void applyDisplayWrites(u32 mark);
+	void resyncDisplayMemory();
+	void workerLoop();
+	void stopWorker();
+	u8 renderMode0(u16 dispcnt);
+	u8 renderMode1(u16 dispcnt);
+	u8 renderMode2(u16 dispcnt);
+	void renderTextBG(u8 bg);
+	void renderAffineBG(u8 bg);
+	void latchReferencePoint(u8 bg);
+	void loadReferencePoints();
+	void stepReferencePoints();
+	void captureCompositorRegs(CompositorRegs& regs);
+	u16 getMosaicLine(u16 bgcnt);
+	void writeScanline();
+	void convertLine(const u16* src, u32* dst, u32 count);
+	u8 renderBitmapMode3(u16 dispcnt);
+	u8 renderBitmapMode4(u16 dispcnt);
+	u8 renderBitmapMode5(u16 dispcnt);
+	const u8* getBitmapPage(u16 dispcnt);
 	void bufferPixels();
 
-	u32 calculateTileOffset(u32 x, u32 y, u8 bpp);
-
 	void updateScanline();
 
 	void setBGMode(u16 lcdstatus);
 	void setHBlankFlag(bool value);
 	void setVBlankFlag(bool value);
 	void setVCountFlag(bool value);
+	void writeDISPSTAT(u16 value);
 	void setScaleFactor(float scaleFactor);
 
 	void writeU8(u32 address, u8 value);
 	void writeU16(u32 address, u16 value);
 	void requestInterrupt(u16 interrupt);
 
-	//Extend 5 bit color val into 8 bits
-	u8 getU8Color(u8 color);
-
 	u8 readU8(u32 address);
 	u16 readU16(u32 address);
+	u16 readIo(u32 address);
 
 	DisplayMode displayMode;
 	BGMode mode;
-	Mode0 mode0;
-	BitmapMode3 mode3;
-	BitmapMode4 mode4;
+	FrameBuffer frame;
+	Screen screen;
+
+	const ScanlineKernels* kernels;
+	//What the lines are drawn from, display memory as of the line being drawn.
+	//Declared before the caches that point into it
+	DisplayMemory renderMem;
+	SpscRing<DisplayWrite, PENDING_DISPLAY_WRITES> displayWrites;
+	u32 displayWritesLogged; //emulation side
+	u32 displayWritesApplied; //render side
+	TileCache tileCache;
+	PaletteCache palette;
+	ObjRenderer objs;
+	Compositor compositor;
+	u32 bgLines[NUM_BACKGROUNDS][SCREEN_WIDTH];
+	u8 bgPriority[NUM_BACKGROUNDS];
+	AffineReference affineRef[NUM_AFFINE_BACKGROUNDS];
+	u32 lineBuffer[SCREEN_WIDTH];
+
+	//Snapshot of the line being drawn, render code reads registers only from here
+	const LineSnapshot* lineRegs;
+	SpscRing<LineSnapshot, PENDING_LINES> pendingLines;
+	PpuRenderMode renderMode;
+	std::thread worker;
+	std::atomic<bool> workerRunning;
+
+	//Signature of the inputs each line of the front buffer was drawn from,
+	//a line with the same signature is copied instead of drawn again
+	u64 lineSignatures[SCREEN_HEIGHT];
+	u32 renderEpoch; //bumped when something outside display memory changes the output
+	bool frameChanged;
 
 	u32 cycleCounter = 0;
-	u16 currentScanline = 0;
+	u16 currentScanline = 0; //VCOUNT
+	//Held here instead of in io, mmio copies it (and VCOUNT) out when the cpu reads them
+	u16 dispstat = 0;
 	MemoryBus* mbus;
 	float displayScaleFactor;
 };
\ No newline at end of file
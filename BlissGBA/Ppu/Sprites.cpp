@@ -0,0 +1,229 @@
+#include "Sprites.h"
+
+//[shape][size] -> width, height
+static const u8 objSizes[3][4][2] = {
+	{ {8, 8}, {16, 16}, {32, 32}, {64, 64} }, //square
+	{ {16, 8}, {32, 8}, {32, 16}, {64, 32} }, //horizontal
+	{ {8, 16}, {8, 32}, {16, 32}, {32, 64} }  //vertical
+};
+
+ObjRenderer::ObjRenderer(DisplayMemory* displayMem, TileCache* tileCache, PaletteCache* palette)
+	:displayMem(displayMem), tileCache(tileCache), palette(palette)
+{
+	invalidate();
+}
+
+void ObjRenderer::invalidate()
+{
+	listsValid = false;
+}
+
+void ObjRenderer::decodeEntry(u8 index)
+{
+	ObjAttributes& obj = objs[index];
+	u16 attr0 = displayMem->readOamU16(index * OAM_ENTRY_SIZE);
+	u16 attr1 = displayMem->readOamU16(index * OAM_ENTRY_SIZE + 2);
+	u16 attr2 = displayMem->readOamU16(index * OAM_ENTRY_SIZE + 4);
+
+	obj.affine = (attr0 >> 8) & 0x1;
+	bool double_size = obj.affine && ((attr0 >> 9) & 0x1);
+	//bit 9 disables regular objs
+	bool disabled = !obj.affine && ((attr0 >> 9) & 0x1);
+	obj.mode = (ObjMode)((attr0 >> 10) & 0x3);
+	obj.mosaic = (attr0 >> 12) & 0x1;
+	obj.is8bpp = (attr0 >> 13) & 0x1;
+	u8 shape = (attr0 >> 14) & 0x3;
+
+	obj.y = attr0 & 0xFF;
+	obj.x = attr1 & 0x1FF;
+	if (obj.x >= 256) obj.x -= 512;
+
+	obj.affineGroup = (attr1 >> 9) & 0x1F;
+	obj.hflip = !obj.affine && ((attr1 >> 12) & 0x1);
+	obj.vflip = !obj.affine && ((attr1 >> 13) & 0x1);
+	u8 size = (attr1 >> 14) & 0x3;
+
+	obj.tile = attr2 & 0x3FF;
+	obj.priority = (attr2 >> 10) & 0x3;
+	obj.paletteBank = (attr2 >> 12) & 0xF;
+
+	//shape 3 is prohibited
+	obj.enabled = !disabled && shape != 3 && obj.mode != ObjMode::Prohibited;
+	if (shape == 3) shape = 0;
+
+	obj.width = objSizes[shape][size][0];
+	obj.height = objSizes[shape][size][1];
+	obj.boundWidth = obj.width * (double_size ? 2 : 1);
+	obj.boundHeight = obj.height * (double_size ? 2 : 1);
+}
+
+void ObjRenderer::buildLists(u16 dispcnt)
+{
+	std::fill(lineCount, lineCount + SCREEN_HEIGHT, 0);
+
+	for (u32 i = 0; i < NUM_OBJS; i++) {
+		decodeEntry(i);
+		const ObjAttributes& obj = objs[i];
+		if (!obj.enabled)
+			continue;
+
+		//y wraps at 256, objs near the bottom continue at the top
+		for (u32 row = 0; row < obj.boundHeight; row++) {
+			u8 line = (obj.y + row) & 0xFF;
+			if (line < SCREEN_HEIGHT)
+				lineObjs[line][lineCount[line]++] = i;
+		}
+	}
+
+	listOamWrites = displayMem->oamDirty.writes;
+	listDispcnt = dispcnt;
+	listsValid = true;
+}
+
+void ObjRenderer::renderScanline(u16 line, u16 dispcnt, u16 mosaic)
+{
+	if (!listsValid || listOamWrites != displayMem->oamDirty.writes || listDispcnt != dispcnt)
+		buildLists(dispcnt);
+
+	std::fill(colors, colors + SCREEN_WIDTH, 0);
+	std::fill(priority, priority + SCREEN_WIDTH, OBJ_NO_PIXEL);
+	std::fill(semiTransparent, semiTransparent + SCREEN_WIDTH, 0);
+	std::fill(window, window + SCREEN_WIDTH, 0);
+
+	mapping1D = (dispcnt >> 6) & 0x1;
+	//bitmap modes (3 - 5) only leave the upper half of obj vram for tiles
+	firstTile = ((dispcnt & 0x7) >= 3) ? OBJ_BITMAP_MODE_FIRST_TILE : 0;
+	mosaicWidth = ((mosaic >> 8) & 0xF) + 1;
+	mosaicHeight = ((mosaic >> 12) & 0xF) + 1;
+
+	bool hblank_free = (dispcnt >> 5) & 0x1;
+	s32 cycles = hblank_free ? OBJ_LINE_CYCLES_HBLANK_FREE : OBJ_LINE_CYCLES;
+
+	for (u32 i = 0; i < lineCount[line]; i++) {
+		const ObjAttributes& obj = objs[lineObjs[line][i]];
+
+		//Objs past the budget are dropped, offscreen pixels still cost
+		s32 cost = obj.affine ? (10 + obj.boundWidth * 2) : obj.width;
+		if (cost > cycles)
+			break;
+		cycles -= cost;
+
+		if (obj.affine)
+			drawAffine(obj, line);
+		else
+			drawRegular(obj, line);
+	}
+
+	for (u32 p = 0; p < 4; p++)
+		std::fill(layers[p], layers[p] + SCREEN_WIDTH, 0);
+	for (u32 x = 0; x < SCREEN_WIDTH; x++) {
+		if (priority[x] != OBJ_NO_PIXEL)
+			layers[priority[x]][x] = colors[x];
+	}
+}
+
+//Mosaic objs sample the first pixel of each mosaic block (in screen space),
+//clamped to the obj's own area
+static inline u32 mosaicRow(u32 row, u16 line, u8 size)
+{
+	return row - std::min<u32>(row, line % size);
+}
+
+static inline s32 mosaicColumn(s32 i, s32 x, u8 size)
+{
+	return std::max<s32>(0, i - (x % size));
+}
+
+void ObjRenderer::drawRegular(const ObjAttributes& obj, u16 line)
+{
+	u32 row = (line - obj.y) & 0xFF;
+	if (obj.mosaic) row = mosaicRow(row, line, mosaicHeight);
+	if (obj.vflip) row = obj.height - 1 - row;
+
+	//Clip to the screen before fetching anything
+	s32 start = std::max<s32>(0, -obj.x);
+	s32 end = std::min<s32>(obj.width, SCREEN_WIDTH - obj.x);
+	for (s32 i = start; i < end; i++) {
+		s32 sample = (obj.mosaic) ? mosaicColumn(i, obj.x + i, mosaicWidth) : i;
+		u32 col = obj.hflip ? (obj.width - 1 - sample) : sample;
+		plot(obj, obj.x + i, fetchPixel(obj, col, row));
+	}
+}
+
+void ObjRenderer::drawAffine(const ObjAttributes& obj, u16 line)
+{
+	//Parameters are 8.8 fixed point, spread over 4 oam entries
+	u32 group = obj.affineGroup * OBJ_AFFINE_GROUP_SIZE;
+	s16 pa = (s16)displayMem->readOamU16(group + 0x06);
+	s16 pb = (s16)displayMem->readOamU16(group + 0x0E);
+	s16 pc = (s16)displayMem->readOamU16(group + 0x16);
+	s16 pd = (s16)displayMem->readOamU16(group + 0x1E);
+
+	//Rotation happens around the center of the bounding box
+	u32 box_row = (line - obj.y) & 0xFF;
+	if (obj.mosaic) box_row = mosaicRow(box_row, line, mosaicHeight);
+	s32 dy = (s32)box_row - (obj.boundHeight / 2);
+	s32 dx = -(obj.boundWidth / 2);
+	s32 tx = (pa * dx) + (pb * dy) + ((obj.width / 2) << 8);
+	s32 ty = (pc * dx) + (pd * dy) + ((obj.height / 2) << 8);
+
+	for (s32 i = 0; i < obj.boundWidth; i++, tx += pa, ty += pc) {
+		s32 x = obj.x + i;
+		if (x < 0 || x >= SCREEN_WIDTH)
+			continue;
+
+		s32 col = tx >> 8;
+		s32 row = ty >> 8;
+		if (obj.mosaic) {
+			//Step back to the start of the block, off the incremental path
+			s32 back = i - mosaicColumn(i, x, mosaicWidth);
+			col = (tx - (pa * back)) >> 8;
+			row = (ty - (pc * back)) >> 8;
+		}
+		if (col < 0 || col >= obj.width || row < 0 || row >= obj.height)
+			continue;
+
+		plot(obj, x, fetchPixel(obj, col, row));
+	}
+}
+
+u8 ObjRenderer::fetchPixel(const ObjAttributes& obj, u32 col, u32 row)
+{
+	//Tile numbers count 32 byte units, 8bpp tiles take two.
+	//2D mapping lays tiles out in a 32x32 unit matrix, 1D packs each obj's rows
+	u32 tiles_per_row = obj.width / 8;
+	u32 unit;
+	if (obj.is8bpp) {
+		u32 stride = mapping1D ? (tiles_per_row * 2) : 32;
+		unit = obj.tile + ((row / 8) * stride) + ((col / 8) * 2);
+	}
+	else {
+		u32 stride = mapping1D ? tiles_per_row : 32;
+		unit = obj.tile + ((row / 8) * stride) + (col / 8);
+	}
+	unit &= 0x3FF;
+	if (unit < firstTile)
+		return 0;
+
+	u32 offset = OBJ_TILE_BASE + (unit * TILE_UNIT_SIZE);
+	const u8* tile = (obj.is8bpp) ? tileCache->getTile8bpp(offset) : tileCache->getTile4bpp(offset);
+	return tile[((row % 8) * 8) + (col % 8)];
+}
+
+void ObjRenderer::plot(const ObjAttributes& obj, s32 x, u8 index)
+{
+	if (index == 0)
+		return;
+
+	if (obj.mode == ObjMode::Window) {
+		window[x] = 1;
+		return;
+	}
+	if (obj.priority >= priority[x])
+		return;
+
+	u16 entry = OBJ_PALETTE_BASE + (obj.is8bpp ? index : (obj.paletteBank * 16 + index));
+	colors[x] = palette->get(entry);
+	priority[x] = obj.priority;
+	semiTransparent[x] = (obj.mode == ObjMode::SemiTransparent);
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "../Utils/Utils.h"
+#include "../Memory/DisplayMemory.h"
+#include "TileCache.h"
+#include "Palette.h"
+#include "FrameBuffer.h"
+
+#define NUM_OBJS 128
+#define OBJ_TILE_BASE 0x10000
+#define OBJ_BITMAP_MODE_FIRST_TILE 512 //bitmap modes use the lower half of obj vram
+#define OBJ_PALETTE_BASE 256
+#define OBJ_AFFINE_GROUP_SIZE 0x20 //4 oam entries, one parameter in each
+
+//Cycles available to the obj renderer per line
+#define OBJ_LINE_CYCLES 1210
+#define OBJ_LINE_CYCLES_HBLANK_FREE 954
+
+#define OBJ_NO_PIXEL 4 //priority of a pixel no obj drew on (priorities are 0 - 3)
+
+enum class ObjMode : u8 {
+	Normal = 0,
+	SemiTransparent,
+	Window,
+	Prohibited
+};
+
+/*
+	One decoded oam entry
+*/
+struct ObjAttributes {
+	bool enabled;
+	bool affine;
+	bool hflip;
+	bool vflip;
+	bool is8bpp;
+	bool mosaic;
+	ObjMode mode;
+	u8 priority;
+	u8 paletteBank;
+	u8 affineGroup;
+	u16 tile;
+	s16 x; //9 bit signed
+	u8 y;
+	u8 width, height;
+	u8 boundWidth, boundHeight; //double size affine sprites draw into twice the area
+};
+
+/*
+	Renders the obj layer one scanline at a time.
+
+	Oam is decoded into a list of objs per scanline (in oam order). The lists are
+	only rebuilt when oam or DISPCNT was written since the last build, so a line
+	never has to look at the entries that don't cover it.
+*/
+struct ObjRenderer {
+	ObjRenderer(DisplayMemory* displayMem, TileCache* tileCache, PaletteCache* palette);
+	void renderScanline(u16 line, u16 dispcnt, u16 mosaic);
+	void invalidate();
+
+	void decodeEntry(u8 index);
+	void buildLists(u16 dispcnt);
+	void drawRegular(const ObjAttributes& obj, u16 line);
+	void drawAffine(const ObjAttributes& obj, u16 line);
+	u8 fetchPixel(const ObjAttributes& obj, u32 col, u32 row);
+	void plot(const ObjAttributes& obj, s32 x, u8 index);
+
+	ObjAttributes objs[NUM_OBJS];
+	u8 lineCount[SCREEN_HEIGHT];
+	u8 lineObjs[SCREEN_HEIGHT][NUM_OBJS];
+	bool listsValid;
+	u32 listOamWrites; //oamDirty.writes when the lists were built
+	u16 listDispcnt;
+
+	//Set up from DISPCNT for the line being drawn
+	bool mapping1D;
+	u16 firstTile;
+	u8 mosaicWidth;
+	u8 mosaicHeight;
+
+	//Line output, the winning obj pixel is the one with the lowest priority
+	//value, the lower oam index wins ties
+	u32 colors[SCREEN_WIDTH];
+	u8 priority[SCREEN_WIDTH];
+	u8 semiTransparent[SCREEN_WIDTH];
+	u8 window[SCREEN_WIDTH]; //pixels covered by obj window sprites
+	u32 layers[4][SCREEN_WIDTH]; //colors split by priority for the compositor
+
+	DisplayMemory* displayMem;
+	TileCache* tileCache;
+	PaletteCache* palette;
+};
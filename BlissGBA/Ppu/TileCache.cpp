@@ -0,0 +1,51 @@
+#include "TileCache.h"
+
+TileCache::TileCache(DisplayMemory* displayMem)
+	:kernels(&getScanlineKernels()), displayMem(displayMem)
+{
+	invalidateAll();
+}
+
+const u8* TileCache::getTile4bpp(u32 vramOffset)
+{
+	u32 entry = vramOffset / TILE_UNIT_SIZE;
+	u8* tile = tiles4bpp[entry];
+	u32 version = displayMem->vramDirty.getVersionAt(entry * TILE_UNIT_SIZE);
+
+	if (!valid4bpp[entry] || version4bpp[entry] != version) {
+		//each byte holds 2 pixels, lower nibble is the left pixel
+		kernels->unpack4bpp(&displayMem->vram[entry * TILE_UNIT_SIZE], tile, TILE_UNIT_SIZE);
+		valid4bpp[entry] = true;
+		version4bpp[entry] = version;
+	}
+	return tile;
+}
+
+const u8* TileCache::getTile8bpp(u32 vramOffset)
+{
+	u32 entry = vramOffset / TILE_UNIT_SIZE;
+	u8* tile = tiles8bpp[entry];
+
+	//last unit of vram has no second half to read from
+	u32 start = entry * TILE_UNIT_SIZE;
+	u32 length = std::min<u32>(TILE_PIXELS, VRAM_SIZE - start);
+
+	//tile can straddle two pages, versions only increase so the sum
+	//changes whenever either page is written
+	u32 version = displayMem->vramDirty.getVersionAt(start)
+		+ displayMem->vramDirty.getVersionAt(start + length - 1);
+
+	if (!valid8bpp[entry] || version8bpp[entry] != version) {
+		std::copy(&displayMem->vram[start], &displayMem->vram[start] + length, tile);
+		std::fill(tile + length, tile + TILE_PIXELS, 0x00);
+		valid8bpp[entry] = true;
+		version8bpp[entry] = version;
+	}
+	return tile;
+}
+
+void TileCache::invalidateAll()
+{
+	std::fill(valid4bpp, valid4bpp + TILE_CACHE_ENTRIES, false);
+	std::fill(valid8bpp, valid8bpp + TILE_CACHE_ENTRIES, false);
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include "../Utils/Utils.h"
+#include "../Memory/DisplayMemory.h"
+#include "Kernels.h"
+
+//Tiles are addressed in 32 byte units (one 4bpp tile), 8bpp tiles
+//span two units
+#define TILE_UNIT_SIZE 32
+#define TILE_CACHE_ENTRIES (VRAM_SIZE / TILE_UNIT_SIZE)
+#define TILE_PIXELS 64
+
+/*
+	Decoded 8x8 tiles, each pixel expanded to its palette index (0 = transparent).
+	Entries are decoded on first use and remember the vram page version(s)
+	they were decoded from, a write to any of those pages makes them stale.
+*/
+struct TileCache {
+	TileCache(DisplayMemory* displayMem);
+	//vramOffset is the offset of the first byte of the tile in vram
+	const u8* getTile4bpp(u32 vramOffset);
+	const u8* getTile8bpp(u32 vramOffset);
+	void invalidateAll();
+
+	u8 tiles4bpp[TILE_CACHE_ENTRIES][TILE_PIXELS];
+	u8 tiles8bpp[TILE_CACHE_ENTRIES][TILE_PIXELS];
+	bool valid4bpp[TILE_CACHE_ENTRIES];
+	bool valid8bpp[TILE_CACHE_ENTRIES];
+	u32 version4bpp[TILE_CACHE_ENTRIES];
+	u32 version8bpp[TILE_CACHE_ENTRIES];
+
+	const ScanlineKernels* kernels;
+	DisplayMemory* displayMem;
+};
@@ -0,0 +1,80 @@
+/*
+	Converts a binary execution trace (.btrc, written by the Logger) into the
+	text trace format, one line per instruction.
+
+	Usage: TraceToText <trace.btrc> [output.txt]   (stdout without an output file)
+	Build: cl /std:c++17 /O2 Tools\TraceToText.cpp Debugger\Trace.cpp Utils\Compress.cpp
+	   or: g++ -std=c++17 -O2 Tools/TraceToText.cpp Debugger/Trace.cpp Utils/Compress.cpp
+*/
+#include "../Debugger/Trace.h"
+#include "../Utils/Compress.h"
+#include <cstdio>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+	if (argc < 2) {
+		fprintf(stderr, "Usage: %s <trace.btrc> [output.txt]\n", argv[0]);
+		return 1;
+	}
+
+	FILE* in = fopen(argv[1], "rb");
+	if (in == nullptr) {
+		fprintf(stderr, "File <%s> failed to open\n", argv[1]);
+		return 1;
+	}
+	FILE* out = (argc > 2) ? fopen(argv[2], "w") : stdout;
+	if (out == nullptr) {
+		fprintf(stderr, "File <%s> failed to open\n", argv[2]);
+		fclose(in);
+		return 1;
+	}
+
+	u32 header[2];
+	if (fread(header, sizeof(header), 1, in) != 1 || header[0] != TRACE_MAGIC || header[1] != TRACE_VERSION) {
+		fprintf(stderr, "<%s> is not a version %d trace\n", argv[1], TRACE_VERSION);
+		return 1;
+	}
+
+	std::vector<u8> stored(TRACE_BLOCK_SIZE);
+	std::vector<u8> raw(TRACE_BLOCK_SIZE);
+	TraceState state = {};
+	char line[TRACE_LINE_SIZE];
+	u64 records = 0;
+
+	u32 sizes[2];
+	while (fread(sizes, sizeof(sizes), 1, in) == 1) {
+		u32 rawSize = sizes[0];
+		u32 storedSize = sizes[1];
+		if (rawSize > TRACE_BLOCK_SIZE || storedSize > rawSize || fread(stored.data(), 1, storedSize, in) != storedSize) {
+			fprintf(stderr, "Trace is cut off after %llu instructions\n", (unsigned long long)records);
+			break;
+		}
+
+		const u8* data = stored.data();
+		if (storedSize != rawSize) {
+			if (!decompressBlock(stored.data(), storedSize, raw.data(), rawSize)) {
+				fprintf(stderr, "Corrupt block after %llu instructions\n", (unsigned long long)records);
+				break;
+			}
+			data = raw.data();
+		}
+
+		u32 pos = 0;
+		while (pos < rawSize) {
+			u32 length = decodeTraceRecord(data + pos, rawSize - pos, state);
+			if (length == 0)
+				break;
+			pos += length;
+
+			u32 lineLength = formatTraceRecord(state, line);
+			fwrite(line, 1, lineLength, out);
+			records++;
+		}
+	}
+
+	fclose(in);
+	if (out != stdout)
+		fclose(out);
+	return 0;
+}
@@ -0,0 +1,121 @@
+#include "Compress.h"
+#include <cstring>
+
+static inline bool writeLength(u8* dst, u32& out, u32 capacity, u32 length)
+{
+	while (length >= 255) {
+		if (out >= capacity) return false;
+		dst[out++] = 255;
+		length -= 255;
+	}
+	if (out >= capacity) return false;
+	dst[out++] = (u8)length;
+	return true;
+}
+
+static bool writeSequence(u8* dst, u32& out, u32 capacity, const u8* literals, u32 literalCount,
+	u32 matchLength, u32 offset)
+{
+	u32 extraMatch = (matchLength >= LZ_MIN_MATCH) ? matchLength - LZ_MIN_MATCH : 0;
+	if (out >= capacity) return false;
+	dst[out++] = (u8)((std::min(literalCount, 15u) << 4) | std::min(extraMatch, 15u));
+
+	if (literalCount >= 15 && !writeLength(dst, out, capacity, literalCount - 15))
+		return false;
+	if (out + literalCount > capacity)
+		return false;
+	memcpy(dst + out, literals, literalCount);
+	out += literalCount;
+
+	if (matchLength == 0)
+		return true;
+
+	if (out + 2 > capacity) return false;
+	dst[out++] = offset & 0xFF;
+	dst[out++] = (offset >> 8) & 0xFF;
+	if (extraMatch >= 15 && !writeLength(dst, out, capacity, extraMatch - 15))
+		return false;
+	return true;
+}
+
+u32 compressBlock(const u8* src, u32 size, u8* dst, u32 capacity)
+{
+	u32 table[1 << LZ_HASH_BITS] = {};
+	u32 pos = 0;
+	u32 anchor = 0;
+	u32 out = 0;
+
+	while (pos + LZ_MIN_MATCH <= size) {
+		u32 sequence;
+		memcpy(&sequence, src + pos, 4);
+		u32 hash = (sequence * 2654435761u) >> (32 - LZ_HASH_BITS);
+		u32 candidate = table[hash];
+		table[hash] = pos;
+
+		if (candidate < pos && pos - candidate <= LZ_MAX_OFFSET && memcmp(src + candidate, src + pos, 4) == 0) {
+			u32 length = LZ_MIN_MATCH;
+			while (pos + length < size && src[candidate + length] == src[pos + length])
+				length++;
+
+			if (!writeSequence(dst, out, capacity, src + anchor, pos - anchor, length, pos - candidate))
+				return 0;
+			pos += length;
+			anchor = pos;
+		}
+		else {
+			pos++;
+		}
+	}
+
+	if (!writeSequence(dst, out, capacity, src + anchor, size - anchor, 0, 0))
+		return 0;
+	return out;
+}
+
+static inline bool readLength(const u8* src, u32& in, u32 size, u32& length)
+{
+	u8 byte;
+	do {
+		if (in >= size) return false;
+		byte = src[in++];
+		length += byte;
+	} while (byte == 255);
+	return true;
+}
+
+bool decompressBlock(const u8* src, u32 size, u8* dst, u32 rawSize)
+{
+	u32 in = 0;
+	u32 out = 0;
+	while (in < size) {
+		u8 token = src[in++];
+		u32 literalCount = token >> 4;
+		if (literalCount == 15 && !readLength(src, in, size, literalCount))
+			return false;
+		if (in + literalCount > size || out + literalCount > rawSize)
+			return false;
+		memcpy(dst + out, src + in, literalCount);
+		in += literalCount;
+		out += literalCount;
+
+		//Last sequence
+		if (out == rawSize)
+			return in == size;
+
+		if (in + 2 > size)
+			return false;
+		u32 offset = src[in] | (src[in + 1] << 8);
+		in += 2;
+		u32 matchLength = token & 0xF;
+		if (matchLength == 15 && !readLength(src, in, size, matchLength))
+			return false;
+		matchLength += LZ_MIN_MATCH;
+
+		if (offset == 0 || offset > out || out + matchLength > rawSize)
+			return false;
+		//Byte by byte, the match may overlap what it produces
+		for (u32 i = 0; i < matchLength; i++, out++)
+			dst[out] = dst[out - offset];
+	}
+	return out == rawSize;
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include "Utils.h"
+
+/*
+	Small lz77 block compressor (lz4 style sequences). Each sequence is a token
+	byte (literal count << 4 | match length - 4), the literals, then a 16 bit
+	match offset. The last sequence of a block only has literals
+*/
+#define LZ_MIN_MATCH 4
+#define LZ_HASH_BITS 12
+#define LZ_MAX_OFFSET 0xFFFF
+
+//Returns the compressed size, 0 if it didn't fit in capacity
+u32 compressBlock(const u8* src, u32 size, u8* dst, u32 capacity);
+//False if the data is corrupt or doesn't decompress to exactly rawSize bytes
+bool decompressBlock(const u8* src, u32 size, u8* dst, u32 rawSize);
@@ -0,0 +1,60 @@
+#include "Crc32.h"
+#include <cstring>
+
+#define CRC32_POLYNOMIAL 0xEDB88320 //reflected 0x04C11DB7
+
+/*
+	Slice by 8 tables, tables[k][b] is the crc of byte b followed by k zero bytes.
+	Built at compile time
+*/
+struct Crc32Tables {
+	u32 tables[8][256];
+};
+
+static constexpr Crc32Tables buildCrc32Tables()
+{
+	Crc32Tables t{};
+	for (u32 i = 0; i < 256; i++) {
+		u32 crc = i;
+		for (s32 bit = 0; bit < 8; bit++)
+			crc = (crc & 0x1) ? (crc >> 1) ^ CRC32_POLYNOMIAL : crc >> 1;
+		t.tables[0][i] = crc;
+	}
+
+	for (u32 i = 0; i < 256; i++) {
+		for (s32 k = 1; k < 8; k++) {
+			u32 prev = t.tables[k - 1][i];
+			t.tables[k][i] = (prev >> 8) ^ t.tables[0][prev & 0xFF];
+		}
+	}
+	return t;
+}
+
+static constexpr Crc32Tables crcTables = buildCrc32Tables();
+
+u32 crc32(const u8* data, u32 length, u32 crc)
+{
+	const auto& t = crcTables.tables;
+	crc = ~crc;
+
+	//8 bytes per step, 8 independent table lookups instead of a chain of 8
+	while (length >= 8) {
+		u32 lo, hi;
+		memcpy(&lo, data, 4);
+		memcpy(&hi, data + 4, 4);
+		lo ^= crc;
+
+		crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^
+			t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+			t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^
+			t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+
+		data += 8;
+		length -= 8;
+	}
+
+	while (length--)
+		crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xFF];
+
+	return ~crc;
+}
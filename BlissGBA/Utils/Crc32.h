@@ -0,0 +1,5 @@
+#pragma once
+#include "Utils.h"
+
+//Standard (zlib/png) crc32, pass the previous result as crc to continue a running crc
+u32 crc32(const u8* data, u32 length, u32 crc = 0);
@@ -0,0 +1,139 @@
+#include "Log.h"
+#include <cstdarg>
+
+const char* logCategoryName(LogCategory category)
+{
+	switch (category) {
+		case LogCategory::Cpu: return "cpu";
+		case LogCategory::Memory: return "memory";
+		case LogCategory::Io: return "io";
+		case LogCategory::Dma: return "dma";
+		case LogCategory::Ppu: return "ppu";
+		case LogCategory::Timer: return "timer";
+		case LogCategory::Cart: return "cart";
+		default: return "?";
+	}
+}
+
+const char* logLevelName(LogLevel level)
+{
+	switch (level) {
+		case LogLevel::Trace: return "trace";
+		case LogLevel::Info: return "info";
+		case LogLevel::Warn: return "warn";
+		case LogLevel::Error: return "error";
+		case LogLevel::Off: return "off";
+		default: return "?";
+	}
+}
+
+LogRing::LogRing()
+{
+	for (u32 i = 0; i < LOG_RING_SIZE; i++)
+		cells[i].sequence.store(i, std::memory_order_relaxed);
+	head.store(0, std::memory_order_relaxed);
+	tail = 0;
+}
+
+bool LogRing::push(LogCategory category, LogLevel level, const char* fmt, va_list args)
+{
+	//Claim a cell, a cell is free for position pos when its sequence equals pos
+	u32 pos = head.load(std::memory_order_relaxed);
+	Cell* cell;
+	while (true) {
+		cell = &cells[pos & (LOG_RING_SIZE - 1)];
+		u32 seq = cell->sequence.load(std::memory_order_acquire);
+		s32 diff = (s32)(seq - pos);
+		if (diff == 0) {
+			if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (diff < 0) {
+			return false; //full
+		}
+		else {
+			pos = head.load(std::memory_order_relaxed);
+		}
+	}
+
+	cell->message.category = category;
+	cell->message.level = level;
+	vsnprintf(cell->message.text, LOG_MESSAGE_SIZE, fmt, args);
+	cell->sequence.store(pos + 1, std::memory_order_release);
+	return true;
+}
+
+bool LogRing::pop(LogMessage& message)
+{
+	Cell& cell = cells[tail & (LOG_RING_SIZE - 1)];
+	if (cell.sequence.load(std::memory_order_acquire) != tail + 1)
+		return false;
+
+	message = cell.message;
+	//Hand the cell back to producers for the next lap
+	cell.sequence.store(tail + LOG_RING_SIZE, std::memory_order_release);
+	tail++;
+	return true;
+}
+
+Log& Log::get()
+{
+	static Log log;
+	return log;
+}
+
+Log::Log()
+{
+	std::fill(levels, levels + (u8)LogCategory::Count, LogLevel::Info);
+	dropped = 0;
+	running = true;
+	writer = std::thread(&Log::writerLoop, this);
+}
+
+Log::~Log()
+{
+	running = false;
+	if (writer.joinable())
+		writer.join();
+}
+
+void Log::setLevel(LogCategory category, LogLevel level)
+{
+	levels[(u8)category] = level;
+}
+
+void Log::write(LogCategory category, LogLevel level, const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	if (!ring.push(category, level, fmt, args))
+		dropped.fetch_add(1, std::memory_order_relaxed);
+	va_end(args);
+}
+
+void Log::flush()
+{
+	LogMessage message;
+	bool wrote = false;
+	while (ring.pop(message)) {
+		FILE* out = (message.level >= LogLevel::Warn) ? stderr : stdout;
+		fprintf(out, "[%s] %s\n", logCategoryName(message.category), message.text);
+		wrote = true;
+	}
+
+	u32 lost = dropped.exchange(0, std::memory_order_relaxed);
+	if (lost != 0)
+		fprintf(stderr, "[log] ring full, %u messages dropped\n", lost);
+	if (wrote || lost != 0)
+		fflush(stdout);
+}
+
+void Log::writerLoop()
+{
+	while (running.load(std::memory_order_acquire)) {
+		flush();
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+	//Whatever was logged during shutdown
+	flush();
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include "Utils.h"
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <cstdarg>
+
+//Categories compiled in, one bit per LogCategory. Builds can pass a smaller
+//mask to strip the log calls of a category entirely
+#ifndef LOG_CATEGORY_MASK
+#define LOG_CATEGORY_MASK 0xFF
+#endif
+
+#define LOG_SITE_LIMIT 10 //messages a single call site may log per second
+#define LOG_MESSAGE_SIZE 128
+#define LOG_RING_SIZE 1024 //must be a power of 2
+
+enum class LogCategory : u8 {
+	Cpu = 0,
+	Memory,
+	Io,
+	Dma,
+	Ppu,
+	Timer,
+	Cart,
+	Count
+};
+
+enum class LogLevel : u8 {
+	Trace = 0,
+	Info,
+	Warn,
+	Error,
+	Off
+};
+
+const char* logCategoryName(LogCategory category);
+const char* logLevelName(LogLevel level);
+
+/*
+	Per call site limiter. Messages over the limit are only counted, the count
+	is handed back with the first message let through in the next window
+*/
+struct LogRateLimit {
+	bool allow(u32& suppressed)
+	{
+		u64 now = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+		suppressed = 0;
+		if (now - windowStart >= 1000) {
+			suppressed = dropped;
+			windowStart = now;
+			count = 0;
+			dropped = 0;
+		}
+
+		if (count >= LOG_SITE_LIMIT) {
+			dropped++;
+			return false;
+		}
+		count++;
+		return true;
+	}
+
+	u64 windowStart = 0;
+	u32 count = 0;
+	u32 dropped = 0;
+};
+
+struct LogMessage {
+	LogCategory category;
+	LogLevel level;
+	char text[LOG_MESSAGE_SIZE];
+};
+
+/*
+	Bounded lock free queue for any number of producers and one consumer,
+	each cell carries a sequence number telling whose turn it is
+*/
+struct LogRing {
+	LogRing();
+	bool push(LogCategory category, LogLevel level, const char* fmt, va_list args);
+	bool pop(LogMessage& message);
+
+	struct Cell {
+		std::atomic<u32> sequence;
+		LogMessage message;
+	};
+	Cell cells[LOG_RING_SIZE];
+	alignas(64) std::atomic<u32> head;
+	alignas(64) u32 tail;
+};
+
+/*
+	Formats messages on the calling thread into the ring, a background thread
+	writes them out so logging never waits on stdout. A full ring drops messages
+*/
+struct Log {
+	static Log& get();
+	~Log();
+
+	inline bool enabled(LogCategory category, LogLevel level) const
+	{
+		return level >= levels[(u8)category];
+	}
+	void setLevel(LogCategory category, LogLevel level);
+	void write(LogCategory category, LogLevel level, const char* fmt, ...);
+	void flush();
+	void writerLoop();
+
+	LogLevel levels[(u8)LogCategory::Count];
+	LogRing ring;
+	std::atomic<u32> dropped;
+	std::atomic<bool> running;
+	std::thread writer;
+
+private:
+	Log();
+};
+
+//printf style, the format should end without a newline.
+//Each use gets its own rate limiter
+#define LOG(category, level, ...) \
+	do { \
+		if constexpr (((LOG_CATEGORY_MASK >> (u32)(category)) & 0x1) != 0) { \
+			if (Log::get().enabled(category, level)) { \
+				static LogRateLimit log_site_limit; \
+				u32 log_suppressed; \
+				if (log_site_limit.allow(log_suppressed)) { \
+					if (log_suppressed != 0) \
+						Log::get().write(category, level, "(%u similar messages suppressed)", log_suppressed); \
+					Log::get().write(category, level, __VA_ARGS__); \
+				} \
+			} \
+		} \
+	} while (0)
+
+#define LOG_TRACE(category, ...) LOG(category, LogLevel::Trace, __VA_ARGS__)
+#define LOG_INFO(category, ...) LOG(category, LogLevel::Info, __VA_ARGS__)
+#define LOG_WARN(category, ...) LOG(category, LogLevel::Warn, __VA_ARGS__)
+#define LOG_ERROR(category, ...) LOG(category, LogLevel::Error, __VA_ARGS__)
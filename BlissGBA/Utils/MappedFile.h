@@ -0,0 +1,22 @@
+#pragma once
+#include "Utils.h"
+
+/*
+	Read only view of a whole file. Pages are read in when first touched and
+	shared with every other process mapping the same file
+*/
+struct MappedFile {
+	MappedFile();
+	~MappedFile();
+	//sequential hints the os to read ahead and drop pages behind the reader
+	bool open(const std::string& fileName, bool sequential = false);
+	void close();
+
+	const u8* data;
+	u64 size;
+
+#ifdef _WIN32
+	void* file;
+	void* mapping;
+#endif
+};
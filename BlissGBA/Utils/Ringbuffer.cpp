@@ -4,28 +4,32 @@ Ringbuffer::Ringbuffer(u32 size)
 {
 	this->size = size;
 	currentIndex = 0;
+	count = 0;
 	buffer = new CpuState[size];
 }
 
 Ringbuffer::~Ringbuffer()
 {
-	delete buffer;
+	delete[] buffer;
 }
 
 void Ringbuffer::print()
 {
 	printf("\n");
-	for (u32 i = 0; i < size; i++) {
-		printf("Opcode: 0x%08X ", buffer[i].opcode);
+	//Oldest first
+	u32 first = (currentIndex + size - count) % size;
+	for (u32 n = 0; n < count; n++) {
+		const CpuState& state = buffer[(first + n) % size];
+		printf("Opcode: 0x%08X ", state.opcode);
 		for (u32 j = 0; j < 13; j++) {
 			printf("R%d: ", j);
-			printf("0x%08X ", buffer[i].regs[j]);
+			printf("0x%08X ", state.regs[j]);
 		}
-		printf("SP: 0x%08X ", buffer[i].sp);
-		printf("LR: 0x%08X ", buffer[i].lr);
-		printf("R15: 0x%08X ", buffer[i].r15);
-		printf("CPSR: 0x%08X ", buffer[i].cpsr);
-		printf("SPSR: 0x%08X \n", buffer[i].spsr);
+		printf("SP: 0x%08X ", state.sp);
+		printf("LR: 0x%08X ", state.lr);
+		printf("R15: 0x%08X ", state.r15);
+		printf("CPSR: 0x%08X ", state.cpsr);
+		printf("SPSR: 0x%08X \n", state.spsr);
 	}
 }
 
@@ -33,6 +37,7 @@ void Ringbuffer::add(CpuState state)
 {
 	buffer[currentIndex] = state;
 	currentIndex++;
+	if (count < size) count++;
 
 	if (currentIndex >= size) currentIndex = 0;
 }
@@ -21,5 +21,6 @@ public:
 
 	CpuState* buffer;
 	u32 currentIndex;
+	u32 count; //states added, up to size
 	u32 size;
 };
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+#include "Utils.h"
+#include <atomic>
+
+/*
+	Lock free ring for exactly one producer and one consumer thread.
+	The consumer may use an item in place (front) and only release
+	its slot (pop) once it is done with it.
+*/
+template<typename T, u32 Capacity>
+struct SpscRing {
+	static_assert((Capacity & (Capacity - 1)) == 0, "capacity must be a power of 2");
+
+	//Producer
+	bool push(const T& item)
+	{
+		u32 h = head.load(std::memory_order_relaxed);
+		if (h - tail.load(std::memory_order_acquire) == Capacity)
+			return false;
+
+		items[h & (Capacity - 1)] = item;
+		head.store(h + 1, std::memory_order_release);
+		return true;
+	}
+
+	//Consumer
+	T* front()
+	{
+		u32 t = tail.load(std::memory_order_relaxed);
+		if (head.load(std::memory_order_acquire) == t)
+			return nullptr;
+		return &items[t & (Capacity - 1)];
+	}
+
+	void pop()
+	{
+		tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	//Either side
+	bool empty() const
+	{
+		return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+	}
+
+	u32 size() const
+	{
+		return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+	}
+
+	T items[Capacity];
+	//Kept on separate cache lines so the two threads don't fight over them
+	alignas(64) std::atomic<u32> head{ 0 };
+	alignas(64) std::atomic<u32> tail{ 0 };
+};